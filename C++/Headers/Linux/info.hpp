@@ -23,7 +23,28 @@
 #include <filesystem>
 #include <fstream>
 #include <sstream>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+#include <unordered_map>
 #include <sys/io.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "../../../include/Hotplug.hpp"
+#include "../../../include/ProcReader.hpp"
 namespace LinuxInfo {
 #define CPUINFO_KPATH "/proc/cpuinfo"
 #define MEMINFO_KPATH "/proc/meminfo"
@@ -40,26 +61,258 @@ namespace LinuxInfo {
 #define MSRINFO_KPATH(cpu) "/dev/cpu/"#cpu"/msr"
 
 namespace fs = std::filesystem;
-inline std::vector<std::pair<std::string, std::string>> getCPUInfo() {
-    std::vector<std::pair<std::string, std::string>> result;
-    std::ifstream file("/proc/cpuinfo");
-    if (!file.is_open()) return result;
 
-    std::string line;
-    while (std::getline(file, line)) {
-        auto pos = line.find(':');
-        if (pos != std::string::npos) {
-            std::string key = line.substr(0, pos);
-            std::string value = line.substr(pos + 1);
-            result.emplace_back(key, value);
+// Every path below is resolved under LiveView::get_sys_root() (empty: the
+// live system), so a tree captured with Tools/SysCapture can be read back.
+
+// Splits "key: value" lines (the /proc/cpuinfo and /proc/meminfo format)
+// at the first ':'. Lines without one are skipped.
+inline std::vector<std::pair<std::string, std::string>> parseKeyValueLines(const std::string& content) {
+    std::vector<std::pair<std::string, std::string>> result;
+    size_t start = 0;
+    while (start < content.size()) {
+        size_t eol = content.find('\n', start);
+        if (eol == std::string::npos) eol = content.size();
+        size_t pos = content.find(':', start);
+        if (pos < eol) {
+            result.emplace_back(content.substr(start, pos - start),
+                                content.substr(pos + 1, eol - pos - 1));
         }
+        start = eol + 1;
     }
     return result;
 }
 
+inline std::vector<std::pair<std::string, std::string>> getCPUInfo() {
+    static thread_local std::string buffer; // Reused between calls
+    if (!LiveView::read_proc_file(CPUINFO_KPATH, buffer)) return {};
+    return parseKeyValueLines(buffer);
+}
+
+// One logical CPU of /proc/cpuinfo. Numbers that are missing (they depend
+// on the architecture and the kernel) stay -1. Strings are indexes into
+// CPUInfoTable::strings, shared by every processor that has the same text.
+struct CPUInfoProcessor {
+    int processor = -1;
+    int physical_id = -1;           // Package (socket)
+    int core_id = -1;
+    int cpu_cores = -1;             // Cores in the package
+    int siblings = -1;              // Logical CPUs in the package
+    int apicid = -1;
+    int family = -1;                // "cpu family"
+    int model = -1;
+    int stepping = -1;
+    int64_t microcode = -1;
+    int64_t cache_size_kB = -1;
+    double mhz = -1;                // "cpu MHz" when the table was parsed
+    double bogomips = -1;
+    uint32_t vendor_id = 0;         // "vendor_id" (0: the empty string)
+    uint32_t model_name = 0;        // "model name"
+    uint32_t flags = 0;             // Index into CPUInfoTable::flagSets
+    // Every other "key: value" line, as (key, value) string indexes
+    std::vector<std::pair<uint32_t, uint32_t>> extra;
+};
+
+// The parsed /proc/cpuinfo. A flag set is a bitset over flagNames ("flags"
+// on x86, "Features" on ARM); processors with the same flags line share one.
+struct CPUInfoTable {
+    std::vector<CPUInfoProcessor> processors;
+    std::vector<std::string> strings{std::string()};
+    std::vector<std::string> flagNames;
+    std::vector<std::vector<uint64_t>> flagSets{std::vector<uint64_t>()};
+
+    const std::string& str(uint32_t index) const { return strings[index]; }
+
+    // Index of a flag in flagNames, -1 if no processor has it.
+    int flagIndex(const std::string& name) const {
+        auto it = std::find(flagNames.begin(), flagNames.end(), name);
+        return it == flagNames.end() ? -1 : static_cast<int>(it - flagNames.begin());
+    }
+
+    bool hasFlag(const CPUInfoProcessor& cpu, int index) const {
+        const std::vector<uint64_t>& bits = flagSets[cpu.flags];
+        return index >= 0 && static_cast<size_t>(index / 64) < bits.size() &&
+               (bits[index / 64] >> (index % 64) & 1);
+    }
+
+    bool hasFlag(const CPUInfoProcessor& cpu, const std::string& name) const {
+        return hasFlag(cpu, flagIndex(name));
+    }
+
+    // The flags of a processor as names, in flagNames order.
+    std::vector<std::string> flagList(const CPUInfoProcessor& cpu) const {
+        std::vector<std::string> result;
+        for (size_t i = 0; i < flagNames.size(); ++i) {
+            if (hasFlag(cpu, static_cast<int>(i))) result.push_back(flagNames[i]);
+        }
+        return result;
+    }
+};
+
+namespace detail {
+
+// Interns strings (and flag names) while one table is parsed.
+class CPUInfoBuilder {
+public:
+    explicit CPUInfoBuilder(CPUInfoTable& table) : table(table) { ids.emplace(std::string(), 0); }
+
+    uint32_t intern(const char* p, size_t n) {
+        scratch.assign(p, n);
+        auto it = ids.find(scratch);
+        if (it != ids.end()) return it->second;
+        uint32_t id = static_cast<uint32_t>(table.strings.size());
+        table.strings.push_back(scratch);
+        ids.emplace(scratch, id);
+        return id;
+    }
+
+    // Bitset index of a flags line; identical lines are split only once.
+    uint32_t flagSet(const char* p, size_t n) {
+        uint32_t line = intern(p, n);
+        auto it = setOfLine.find(line);
+        if (it != setOfLine.end()) return it->second;
+        std::vector<uint64_t> bits;
+        const char* end = p + n;
+        while (p < end) {
+            while (p < end && (*p == ' ' || *p == '\t')) ++p;
+            const char* word = p;
+            while (p < end && *p != ' ' && *p != '\t') ++p;
+            if (p == word) break;
+            scratch.assign(word, p);
+            auto flag = flagIds.find(scratch);
+            size_t index;
+            if (flag != flagIds.end()) {
+                index = flag->second;
+            } else {
+                index = table.flagNames.size();
+                table.flagNames.push_back(scratch);
+                flagIds.emplace(scratch, index);
+            }
+            if (bits.size() <= index / 64) bits.resize(index / 64 + 1, 0);
+            bits[index / 64] |= uint64_t(1) << (index % 64);
+        }
+        uint32_t id = static_cast<uint32_t>(table.flagSets.size());
+        table.flagSets.push_back(std::move(bits));
+        setOfLine.emplace(line, id);
+        return id;
+    }
+
+private:
+    CPUInfoTable& table;
+    std::unordered_map<std::string, uint32_t> ids;
+    std::unordered_map<std::string, size_t> flagIds;
+    std::unordered_map<uint32_t, uint32_t> setOfLine;
+    std::string scratch;
+};
+
+inline bool cpuInfoKeyIs(const char* key, size_t n, const char* name) {
+    return std::char_traits<char>::length(name) == n &&
+           std::char_traits<char>::compare(key, name, n) == 0;
+}
+
+} // namespace detail
+
+// Parses the text of /proc/cpuinfo into one record per processor. A
+// "processor" line starts a record; lines before the first one get a record
+// of their own (processor -1), and trailing system-wide lines (the
+// "Hardware" block of 32-bit ARM) end up in the extra of the last one.
+inline CPUInfoTable parseCPUInfo(const std::string& content) {
+    CPUInfoTable table;
+    detail::CPUInfoBuilder builder(table);
+    std::string number; // NUL-terminated copy of a value for strtod/strtoll
+    auto asInt = [&](const char* p, size_t n, int base) -> int64_t {
+        number.assign(p, n);
+        char* stop;
+        long long value = std::strtoll(number.c_str(), &stop, base);
+        return stop == number.c_str() ? -1 : static_cast<int64_t>(value);
+    };
+    auto asDouble = [&](const char* p, size_t n) -> double {
+        number.assign(p, n);
+        char* stop;
+        double value = std::strtod(number.c_str(), &stop);
+        return stop == number.c_str() ? -1 : value;
+    };
+
+    const char* p = content.data();
+    const char* end = p + content.size();
+    CPUInfoProcessor* cpu = nullptr;
+    while (p < end) {
+        const char* line = p;
+        const char* eol = static_cast<const char*>(std::memchr(p, '\n', end - p));
+        if (!eol) eol = end;
+        p = eol + (eol < end);
+        const char* colon = static_cast<const char*>(std::memchr(line, ':', eol - line));
+        if (!colon) continue;
+        // "model name\t: AMD ..." -> "model name" and "AMD ..."
+        const char* keyEnd = colon;
+        while (keyEnd > line && (keyEnd[-1] == ' ' || keyEnd[-1] == '\t')) --keyEnd;
+        const char* value = colon + 1;
+        while (value < eol && (*value == ' ' || *value == '\t')) ++value;
+        const char* valueEnd = eol;
+        while (valueEnd > value && (valueEnd[-1] == ' ' || valueEnd[-1] == '\t' || valueEnd[-1] == '\r')) --valueEnd;
+        size_t keyLen = keyEnd - line;
+        size_t valueLen = valueEnd - value;
+
+        if (detail::cpuInfoKeyIs(line, keyLen, "processor")) {
+            table.processors.emplace_back();
+            cpu = &table.processors.back();
+            cpu->processor = static_cast<int>(asInt(value, valueLen, 10));
+            continue;
+        }
+        if (!cpu) {
+            table.processors.emplace_back();
+            cpu = &table.processors.back();
+        }
+        if (detail::cpuInfoKeyIs(line, keyLen, "physical id")) cpu->physical_id = static_cast<int>(asInt(value, valueLen, 10));
+        else if (detail::cpuInfoKeyIs(line, keyLen, "core id")) cpu->core_id = static_cast<int>(asInt(value, valueLen, 10));
+        else if (detail::cpuInfoKeyIs(line, keyLen, "cpu cores")) cpu->cpu_cores = static_cast<int>(asInt(value, valueLen, 10));
+        else if (detail::cpuInfoKeyIs(line, keyLen, "siblings")) cpu->siblings = static_cast<int>(asInt(value, valueLen, 10));
+        else if (detail::cpuInfoKeyIs(line, keyLen, "apicid")) cpu->apicid = static_cast<int>(asInt(value, valueLen, 10));
+        else if (detail::cpuInfoKeyIs(line, keyLen, "cpu family")) cpu->family = static_cast<int>(asInt(value, valueLen, 10));
+        else if (detail::cpuInfoKeyIs(line, keyLen, "model")) cpu->model = static_cast<int>(asInt(value, valueLen, 10));
+        else if (detail::cpuInfoKeyIs(line, keyLen, "stepping")) cpu->stepping = static_cast<int>(asInt(value, valueLen, 10));
+        else if (detail::cpuInfoKeyIs(line, keyLen, "microcode")) cpu->microcode = asInt(value, valueLen, 0); // "0xa201016"
+        else if (detail::cpuInfoKeyIs(line, keyLen, "cache size")) cpu->cache_size_kB = asInt(value, valueLen, 10); // "512 KB"
+        else if (detail::cpuInfoKeyIs(line, keyLen, "cpu MHz")) cpu->mhz = asDouble(value, valueLen);
+        else if (detail::cpuInfoKeyIs(line, keyLen, "bogomips") || detail::cpuInfoKeyIs(line, keyLen, "BogoMIPS")) cpu->bogomips = asDouble(value, valueLen);
+        else if (detail::cpuInfoKeyIs(line, keyLen, "vendor_id")) cpu->vendor_id = builder.intern(value, valueLen);
+        else if (detail::cpuInfoKeyIs(line, keyLen, "model name")) cpu->model_name = builder.intern(value, valueLen);
+        else if (detail::cpuInfoKeyIs(line, keyLen, "flags") || detail::cpuInfoKeyIs(line, keyLen, "Features")) cpu->flags = builder.flagSet(value, valueLen);
+        else cpu->extra.emplace_back(builder.intern(line, keyLen), builder.intern(value, valueLen));
+    }
+    return table;
+}
+
+// The parsed /proc/cpuinfo, cached until the set of online CPUs (or the
+// sysroot) changes: offline CPUs are not listed in /proc/cpuinfo, so hotplug
+// is the only event that changes its records. Fields that vary on their own
+// ("cpu MHz") are as of the last parse. The table is shared and immutable;
+// it is empty if /proc/cpuinfo cannot be read.
+inline std::shared_ptr<const CPUInfoTable> getCPUInfoTable() {
+    static std::mutex mutex;
+    static std::shared_ptr<const CPUInfoTable> cached;
+    static std::string cachedMask;
+    static std::string mask; // Reused: a cache hit does not allocate
+    static uint64_t cachedRoot = 0;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    LiveView::read_proc_file("/sys/devices/system/cpu/online", mask);
+    uint64_t root = LiveView::sys_root_generation();
+    if (cached && mask == cachedMask && root == cachedRoot) return cached;
+
+    std::string buffer;
+    if (!LiveView::read_proc_file(CPUINFO_KPATH, buffer)) {
+        return std::make_shared<const CPUInfoTable>(); // Not cached
+    }
+    cached = std::make_shared<const CPUInfoTable>(parseCPUInfo(buffer));
+    cachedMask.swap(mask);
+    cachedRoot = root;
+    return cached;
+}
+
 inline std::vector<std::pair<std::string, std::string>> getNetworkInfo() {
     std::vector<std::pair<std::string, std::string>> result;
-    std::string basePath = "/sys/class/net/";
+    std::string basePath = LiveView::sys_path(std::string("/sys/class/net/"));
 
     if (!fs::exists(basePath)) return result;
 
@@ -82,14 +335,212 @@ inline std::vector<std::pair<std::string, std::string>> getNetworkInfo() {
     return result;
 }
 
-inline std::vector<std::pair<std::string, std::string>> getGPUInfo(bool AMD = false) {
+// Attributes of /sys/class/net/<iface> for getNetworkInfo(fields). Only the
+// files of the requested fields are opened.
+enum NetField : uint32_t {
+    NET_ADDRESS      = 1u << 0,  // address: MAC (link-layer) address
+    NET_MTU          = 1u << 1,  // mtu
+    NET_SPEED        = 1u << 2,  // speed: Mb/s, unknown for links that are down or virtual
+    NET_OPERSTATE    = 1u << 3,  // operstate: "up", "down", "unknown"...
+    NET_CARRIER      = 1u << 4,  // carrier: 1 if the link is up
+    NET_DUPLEX       = 1u << 5,  // duplex: "full", "half" or "unknown"
+    NET_IFINDEX      = 1u << 6,  // ifindex
+    NET_TYPE         = 1u << 7,  // type: ARPHRD_* link type (1 = Ethernet, 772 = loopback)
+    NET_TX_QUEUE_LEN = 1u << 8,  // tx_queue_len
+    NET_FLAGS        = 1u << 9,  // flags: IFF_* bits
+    NET_ALL          = (1u << 10) - 1
+};
+
+// One interface as read by getNetworkInfo(fields). Fields that were not
+// requested, or could not be read, keep their defaults (-1 or "") and are
+// missing from `fields`.
+struct NetInterfaceInfo {
+    std::string name;
+    uint32_t fields = 0;        // NetField bits that were read
+    std::string address;
+    std::string operstate;
+    std::string duplex;
+    int64_t mtu = -1;
+    int64_t speed = -1;         // Mb/s
+    int64_t carrier = -1;
+    int64_t ifindex = -1;
+    int64_t type = -1;
+    int64_t tx_queue_len = -1;
+    int64_t flags = -1;
+};
+
+// sysfs file name of every NetField, in bit order.
+inline const char* const* netFieldNames() {
+    static const char* const names[] = {"address", "mtu", "speed", "operstate", "carrier",
+                                        "duplex", "ifindex", "type", "tx_queue_len", "flags"};
+    return names;
+}
+
+// Builds a field mask from attribute names, e.g. {"mtu", "speed"}.
+// Throws std::invalid_argument for an unknown name.
+inline uint32_t netFieldMask(const std::vector<std::string>& names) {
+    uint32_t mask = 0;
+    for (const auto& name : names) {
+        uint32_t bit = 0;
+        for (int i = 0; (1u << i) & NET_ALL; ++i) {
+            if (name == netFieldNames()[i]) bit = 1u << i;
+        }
+        if (!bit) throw std::invalid_argument("Unknown network attribute: " + name);
+        mask |= bit;
+    }
+    return mask;
+}
+
+// Reads the first line of a sysfs attribute relative to a directory.
+inline bool readSysAttr(int dirFd, const char* name, std::string& value) {
+    int fd = openat(dirFd, name, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return false;
+    char buffer[256];
+    ssize_t n;
+    do {
+        n = read(fd, buffer, sizeof(buffer) - 1);
+    } while (n < 0 && errno == EINTR);
+    close(fd);
+    if (n <= 0) return false; // e.g. EINVAL: speed of a link that is down
+    size_t len = static_cast<size_t>(n);
+    while (len > 0 && (buffer[len - 1] == '\n' || buffer[len - 1] == ' ')) --len;
+    value.assign(buffer, len);
+    return true;
+}
+
+// Field-selective variant of getNetworkInfo(): only the attributes in
+// `fields` (NetField bits) are read, one file each, and parsed into a typed
+// struct. With thousands of interfaces (containers, veths) this avoids
+// opening the dozens of other attribute files of every interface.
+inline std::vector<NetInterfaceInfo> getNetworkInfo(uint32_t fields) {
+    std::vector<NetInterfaceInfo> result;
+    std::string basePath = LiveView::sys_path(std::string("/sys/class/net"));
+    int netFd = open(basePath.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (netFd < 0) return result;
+    DIR* dir = fdopendir(netFd);
+    if (!dir) {
+        close(netFd);
+        return result;
+    }
+
+    std::string value;
+    while (dirent* entry = readdir(dir)) {
+        // Interfaces are symlinks (directories in a captured tree); skip
+        // ".", ".." and files such as bonding_masters.
+        if (entry->d_name[0] == '.' || entry->d_type == DT_REG) continue;
+        int ifaceFd = openat(netFd, entry->d_name, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if (ifaceFd < 0) continue;
+
+        NetInterfaceInfo info;
+        info.name = entry->d_name;
+        for (int i = 0; (1u << i) & NET_ALL; ++i) {
+            uint32_t bit = 1u << i;
+            if (!(fields & bit) || !readSysAttr(ifaceFd, netFieldNames()[i], value)) continue;
+            char* end = nullptr;
+            // flags is hexadecimal ("0x1003"), the other numbers decimal
+            long long number = std::strtoll(value.c_str(), &end, 0);
+            bool numeric = end != value.c_str();
+            switch (bit) {
+            case NET_ADDRESS: info.address = value; break;
+            case NET_OPERSTATE: info.operstate = value; break;
+            case NET_DUPLEX: info.duplex = value; break;
+            case NET_MTU: if (numeric) info.mtu = number; break;
+            case NET_SPEED: if (numeric) info.speed = number; break;
+            case NET_CARRIER: if (numeric) info.carrier = number; break;
+            case NET_IFINDEX: if (numeric) info.ifindex = number; break;
+            case NET_TYPE: if (numeric) info.type = number; break;
+            case NET_TX_QUEUE_LEN: if (numeric) info.tx_queue_len = number; break;
+            case NET_FLAGS: if (numeric) info.flags = number; break;
+            }
+            if (bit == NET_ADDRESS || bit == NET_OPERSTATE || bit == NET_DUPLEX || numeric)
+                info.fields |= bit;
+        }
+        close(ifaceFd);
+        result.push_back(std::move(info));
+    }
+    closedir(dir); // Also closes netFd
+    return result;
+}
+
+// Same, with the attributes given by name, e.g. {"mtu", "operstate"}.
+inline std::vector<NetInterfaceInfo> getNetworkInfo(const std::vector<std::string>& fields) {
+    return getNetworkInfo(netFieldMask(fields));
+}
+
+// Inventory calls (getPCIDevices, getUSBInfo, getDisks, getGPUInfo) keep
+// their last result until a device of their subsystem is hotplugged (see
+// Hotplug.hpp), the sysroot changes or the result gets older than the
+// maximum age, a safety net for changes no event reports. Attribute values
+// that move on their own (power/runtime_* of a device) are as of the scan.
+namespace detail {
+
+inline std::atomic<int>& inventoryMaxAge() {
+    static std::atomic<int> seconds{300};
+    return seconds;
+}
+
+template <typename T>
+class InventoryCache {
+public:
+    explicit InventoryCache(const char* subsystem) : subsystem(subsystem) {}
+
+    template <typename Load>
+    T get(Load load) {
+        int maxAge = inventoryMaxAge().load(std::memory_order_relaxed);
+        if (maxAge <= 0) return load();
+        // Read before scanning: an event during the scan forces the next one
+        uint64_t generation = LiveView::HotplugMonitor::instance().generation(subsystem);
+        uint64_t root = LiveView::sys_root_generation();
+        auto now = std::chrono::steady_clock::now();
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (valid && generation == cachedGeneration && root == cachedRoot &&
+                now - loadedAt < std::chrono::seconds(maxAge)) {
+                return value;
+            }
+        }
+        T fresh = load();
+        std::lock_guard<std::mutex> lock(mutex);
+        value = fresh;
+        cachedGeneration = generation;
+        cachedRoot = root;
+        loadedAt = now;
+        valid = true;
+        return fresh;
+    }
+
+private:
+    const char* subsystem;
+    std::mutex mutex;
+    T value;
+    uint64_t cachedGeneration = 0;
+    uint64_t cachedRoot = 0;
+    std::chrono::steady_clock::time_point loadedAt;
+    bool valid = false;
+};
+
+} // namespace detail
+
+// Maximum age of a cached inventory result in seconds (300 by default); 0
+// turns the cache off and every call scans again.
+inline void setInventoryCacheMaxAge(int seconds) {
+    detail::inventoryMaxAge().store(seconds < 0 ? 0 : seconds, std::memory_order_relaxed);
+}
+
+// Drops every cached inventory result, e.g. after a change the kernel does
+// not announce.
+inline void invalidateInventoryCache() {
+    LiveView::HotplugMonitor::instance().invalidate_all();
+}
+
+inline std::vector<std::pair<std::string, std::string>> scanGPUInfo(bool AMD = false) {
     std::vector<std::pair<std::string, std::string>> result;
     std::string basePath;
 
     if (AMD) {
-        basePath = "/sys/class/kfd"; 
+        basePath = LiveView::sys_path(std::string(GPUAMD_KPATH)); 
     } else {
-        basePath = "/sys/class/drm"; 
+        basePath = LiveView::sys_path(std::string(GPUINFO_KPATH)); 
     }
 
     if (!fs::exists(basePath)) return result;
@@ -113,39 +564,35 @@ inline std::vector<std::pair<std::string, std::string>> getGPUInfo(bool AMD = fa
     return result;
 }
 
-inline std::vector<std::pair<std::string, std::string>> getMemoryInfo() {
-    std::vector<std::pair<std::string, std::string>> result;
-    std::ifstream file("/proc/meminfo");
-    if (!file.is_open()) return result;
+inline std::vector<std::pair<std::string, std::string>> getGPUInfo(bool AMD = false) {
+    using Result = std::vector<std::pair<std::string, std::string>>;
+    static detail::InventoryCache<Result> drm("drm");
+    static detail::InventoryCache<Result> kfd("kfd");
+    return (AMD ? kfd : drm).get([AMD] { return scanGPUInfo(AMD); });
+}
 
-    std::string line;
-    while (std::getline(file, line)) {
-        auto pos = line.find(':');
-        if (pos != std::string::npos) {
-            std::string key = line.substr(0, pos);
-            std::string value = line.substr(pos + 1);
-            result.emplace_back(key, value);
-        }
-    }
-    return result;
+inline std::vector<std::pair<std::string, std::string>> getMemoryInfo() {
+    static thread_local std::string buffer; // Reused between calls
+    if (!LiveView::read_proc_file(MEMINFO_KPATH, buffer)) return {};
+    return parseKeyValueLines(buffer);
 }
 
 inline std::tuple<double, double> getLoadAndUptime() {
     double loadavg = 0.0, uptime = 0.0;
-    std::ifstream loadFile("/proc/loadavg");
+    std::ifstream loadFile(LiveView::sys_path(std::string(LOADINFO_KPATH)));
     if (loadFile.is_open()) {
         loadFile >> loadavg;
     }
-    std::ifstream upFile("/proc/uptime");
+    std::ifstream upFile(LiveView::sys_path(std::string(UPTIMEINFO_KPATH)));
     if (upFile.is_open()) {
         upFile >> uptime;
     }
     return {loadavg, uptime};
 }
 
-inline std::vector<std::tuple<std::string, uint64_t>> getDisks() {
+inline std::vector<std::tuple<std::string, uint64_t>> scanDisks() {
     std::vector<std::tuple<std::string, uint64_t>> result;
-    std::ifstream file("/proc/partitions");
+    std::ifstream file(LiveView::sys_path(std::string("/proc/partitions")));
     if (!file.is_open()) return result;
 
     std::string line;
@@ -164,21 +611,186 @@ inline std::vector<std::tuple<std::string, uint64_t>> getDisks() {
     return result;
 }
 
-inline std::vector<std::pair<std::string, std::string>> readDirectoryValues(const std::string& dirPath) {
+inline std::vector<std::tuple<std::string, uint64_t>> getDisks() {
+    static detail::InventoryCache<std::vector<std::tuple<std::string, uint64_t>>> cache("block");
+    return cache.get(scanDisks);
+}
+
+// Limits of readDirectoryValues().
+struct SysfsWalkOptions {
+    // Directory levels read below each entry of the walked directory
+    // (0: only the entry's own attributes).
+    int maxDepth = 1;
+    // Threads walking the entries in parallel (0 or 1: the calling thread).
+    unsigned threads = 4;
+    // Bytes read from each file; only the first line is kept.
+    size_t maxRead = 4096;
+    // Attribute names never read: binary blobs, and files whose read has
+    // side effects or blocks on the hardware. A trailing '*' matches a prefix.
+    std::vector<std::string> skip = {
+        "config", "rom", "vpd", "resource*", "descriptors", "eeprom", "nvmem", "edid",
+        "remove", "rescan", "reset", "bind", "unbind", "new_id", "remove_id"};
+};
+
+namespace detail {
+
+inline bool sysfsSkipped(const SysfsWalkOptions& options, const char* name) {
+    for (const auto& pattern : options.skip) {
+        if (!pattern.empty() && pattern.back() == '*') {
+            if (pattern.compare(0, pattern.size() - 1, name, 0, pattern.size() - 1) == 0 &&
+                std::char_traits<char>::length(name) >= pattern.size() - 1)
+                return true;
+        } else if (pattern == name) {
+            return true;
+        }
+    }
+    return false;
+}
+
+using InodeSet = std::set<std::pair<dev_t, ino_t>>;
+
+// Reads the attributes of one directory (consumes dirFd) and recurses into
+// its real subdirectories. Symlinks (subsystem, driver, device, port...)
+// are never followed here, and directories already reached elsewhere are
+// skipped, so the walk cannot loop or read a device twice.
+inline void walkSysfsDirectory(int dirFd, const std::string& prefix, int depth,
+                               const SysfsWalkOptions& options, const InodeSet& topLevel,
+                               InodeSet& visited,
+                               std::vector<std::pair<std::string, std::string>>& out) {
+    DIR* dir = fdopendir(dirFd);
+    if (!dir) {
+        close(dirFd);
+        return;
+    }
+    std::vector<std::pair<std::string, unsigned char>> entries;
+    while (dirent* entry = readdir(dir)) {
+        if (entry->d_name[0] == '.') continue;
+        entries.emplace_back(entry->d_name, entry->d_type);
+    }
+    std::sort(entries.begin(), entries.end());
+
+    std::string buffer(options.maxRead, '\0');
+    for (const auto& entry : entries) {
+        const char* name = entry.first.c_str();
+        if (entry.second == DT_LNK || sysfsSkipped(options, name)) continue;
+        if (entry.second == DT_DIR) {
+            if (depth >= options.maxDepth) continue;
+            int subFd = openat(dirfd(dir), name, O_RDONLY | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC);
+            if (subFd < 0) continue;
+            struct stat st;
+            if (fstat(subFd, &st) != 0 || topLevel.count({st.st_dev, st.st_ino}) ||
+                !visited.insert({st.st_dev, st.st_ino}).second) {
+                close(subFd);
+                continue;
+            }
+            walkSysfsDirectory(subFd, prefix + entry.first + "/", depth + 1, options, topLevel,
+                               visited, out);
+            continue;
+        }
+        // O_NONBLOCK: a few attributes wait for the hardware. Write-only
+        // attributes fail to open.
+        int fd = openat(dirfd(dir), name, O_RDONLY | O_NONBLOCK | O_NOFOLLOW | O_CLOEXEC);
+        if (fd < 0) continue;
+        ssize_t n;
+        do {
+            n = read(fd, &buffer[0], buffer.size());
+        } while (n < 0 && errno == EINTR);
+        close(fd);
+        if (n < 0) continue;
+        size_t len = static_cast<size_t>(n);
+        size_t eol = buffer.find('\n');
+        if (eol < len) len = eol;
+        out.emplace_back(prefix + entry.first, buffer.substr(0, len));
+    }
+    closedir(dir);
+}
+
+} // namespace detail
+
+// Reads the first line of the attributes of every entry of a sysfs
+// directory such as /sys/bus/pci/devices, as ("<entry>/<attribute>", value)
+// pairs in sorted order. The entries (symlinks into /sys/devices) are
+// followed, each one is walked at most once (by inode) up to
+// options.maxDepth levels down, the names in options.skip are never read,
+// and the entries are spread over a few threads, so the time is bounded by
+// the number of devices rather than by the size of the device tree.
+inline std::vector<std::pair<std::string, std::string>> readDirectoryValues(
+    const std::string& dirPath, const SysfsWalkOptions& options = SysfsWalkOptions()) {
     std::vector<std::pair<std::string, std::string>> result;
-    if (!fs::exists(dirPath)) return result;
+    int rootFd = open(dirPath.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (rootFd < 0) return result;
+    DIR* root = fdopendir(rootFd);
+    if (!root) {
+        close(rootFd);
+        return result;
+    }
 
-    for (const auto& entry : fs::recursive_directory_iterator(dirPath)) {
-        if (fs::is_regular_file(entry.path()) || fs::is_symlink(entry.path())) {
-            std::ifstream file(entry.path());
-            if (!file.is_open()) continue;
+    // Resolve every entry first: the set of top-level inodes lets the
+    // walkers skip subdirectories that are also entries (USB interfaces, for
+    // one) without depending on which thread gets there first.
+    std::vector<std::string> names;
+    while (dirent* entry = readdir(root)) {
+        if (entry->d_name[0] != '.') names.emplace_back(entry->d_name);
+    }
+    std::sort(names.begin(), names.end());
+    std::vector<std::string> entries;
+    bool hasFiles = false;
+    detail::InodeSet topLevel;
+    for (const auto& name : names) {
+        struct stat st;
+        if (fstatat(rootFd, name.c_str(), &st, 0) != 0) continue;
+        if (!S_ISDIR(st.st_mode))
+            hasFiles = true; // An attribute of the walked directory itself
+        else if (topLevel.insert({st.st_dev, st.st_ino}).second)
+            entries.push_back(name); // Not another name for a listed entry
+    }
+    if (hasFiles) {
+        SysfsWalkOptions flat = options;
+        flat.maxDepth = 0;
+        detail::InodeSet visited;
+        int fd = openat(rootFd, ".", O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if (fd >= 0) detail::walkSysfsDirectory(fd, "", 0, flat, topLevel, visited, result);
+    }
 
-            std::string content;
-            std::getline(file, content);
-            result.emplace_back(entry.path().filename().string(), content);
+    // Entries are claimed one at a time and their results merged in name
+    // order, so the output does not depend on the number of threads.
+    std::vector<std::vector<std::pair<std::string, std::string>>> parts(entries.size());
+    std::atomic<size_t> next{0};
+    auto worker = [&]() {
+        for (size_t i; (i = next.fetch_add(1)) < entries.size();) {
+            int fd = openat(rootFd, entries[i].c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+            if (fd < 0) continue;
+            detail::InodeSet visited;
+            detail::walkSysfsDirectory(fd, entries[i] + "/", 0, options, topLevel, visited,
+                                       parts[i]);
         }
+    };
+    // One thread per 8 entries at most: small directories stay sequential
+    size_t threadCount = std::min<size_t>(options.threads, (entries.size() + 7) / 8);
+    std::vector<std::thread> pool;
+    pool.reserve(threadCount);
+    for (size_t t = 1; t < threadCount; ++t) {
+        try {
+            pool.emplace_back(worker);
+        } catch (const std::system_error&) {
+            break; // e.g. EAGAIN under a pids cgroup limit: go on with fewer
+        }
+    }
+    try {
+        worker();
+    } catch (...) {
+        next = entries.size(); // Stop the other workers, then join them
+        for (auto& t : pool) t.join();
+        closedir(root);
+        throw;
     }
+    for (auto& t : pool) t.join();
+    closedir(root);
 
+    for (auto& part : parts) {
+        result.insert(result.end(), std::make_move_iterator(part.begin()),
+                      std::make_move_iterator(part.end()));
+    }
     return result;
 }
 
@@ -193,16 +805,22 @@ void outPort(uint16_t port, uint8_t value) {
 
 
 inline std::vector<std::pair<std::string, std::string>> getBatteryInfo() {
-    return readDirectoryValues("/sys/class/power_supply/");
+    return readDirectoryValues(LiveView::sys_path(std::string("/sys/class/power_supply/")));
 }
 
 
 inline std::vector<std::pair<std::string, std::string>> getUSBInfo() {
-    return readDirectoryValues("/sys/bus/usb/devices/");
+    static detail::InventoryCache<std::vector<std::pair<std::string, std::string>>> cache("usb");
+    return cache.get([] {
+        return readDirectoryValues(LiveView::sys_path(std::string("/sys/bus/usb/devices/")));
+    });
 }
 
 inline std::vector<std::pair<std::string, std::string>> getPCIDevices() {
-    return readDirectoryValues("/sys/bus/pci/devices/");
+    static detail::InventoryCache<std::vector<std::pair<std::string, std::string>>> cache("pci");
+    return cache.get([] {
+        return readDirectoryValues(LiveView::sys_path(std::string("/sys/bus/pci/devices/")));
+    });
 }
 
 }
\ No newline at end of file
@@ -12,12 +12,21 @@
 ================================================================================
 */
 #pragma once
+#ifdef _WIN32
 #include <windows.h>
+#else
+#include <cerrno>
+#endif
+#include <fstream>
+#include <iterator>
 #include <vector>
 #include <string>
 #include <map>
 #include <memory>
+#include <cstddef>
 #include <cstdint>
+#include <cstdio>
+#include <cstring>
 namespace HV {
 namespace SMBIOS {
 // SMBIOS Structure Types
@@ -804,7 +813,7 @@ public:
 
     inline std::string FormatUUID(const uint8_t uuid[16]) {
         char buffer[37];
-        sprintf_s(buffer, sizeof(buffer),
+        std::snprintf(buffer, sizeof(buffer),
             "%02X%02X%02X%02X-%02X%02X-%02X%02X-%02X%02X-%02X%02X%02X%02X%02X%02X",
             uuid[3], uuid[2], uuid[1], uuid[0],
             uuid[5], uuid[4], uuid[7], uuid[6],
@@ -1264,6 +1273,7 @@ inline void ParseCacheInformation(const CacheInformation* cache) {
     inline ~SMBIOSParser() {}
 
     // Main methods
+#ifdef _WIN32
     inline bool LoadSMBIOSData() {
         DWORD buffer_size = 0;
         
@@ -1285,6 +1295,58 @@ inline void ParseCacheInformation(const CacheInformation* cache) {
         memset((raw_data.get() + buffer_size),0,512);
         return true;
     }
+#else
+    // Linux exposes the same table in sysfs (readable by root only).
+    inline bool LoadSMBIOSData() {
+        return LoadSMBIOSFiles("/sys/firmware/dmi/tables");
+    }
+#endif
+
+    // Loads a table in the sysfs layout: a directory holding the
+    // "smbios_entry_point" and "DMI" files (or a copy of them).
+    inline bool LoadSMBIOSFiles(const std::string& tables_dir) {
+        std::ifstream entry_file(tables_dir + "/smbios_entry_point", std::ios::binary);
+        std::ifstream table_file(tables_dir + "/DMI", std::ios::binary);
+        if (!entry_file.is_open() || !table_file.is_open()) {
+            return false;
+        }
+        std::vector<uint8_t> entry((std::istreambuf_iterator<char>(entry_file)),
+                                   std::istreambuf_iterator<char>());
+        std::vector<uint8_t> table((std::istreambuf_iterator<char>(table_file)),
+                                   std::istreambuf_iterator<char>());
+
+        // "_SM_" (SMBIOS 2.x) and "_SM3_" (SMBIOS 3.x) entry points
+        uint8_t major = 0, minor = 0;
+        if (entry.size() >= 9 && memcmp(entry.data(), "_SM3_", 5) == 0) {
+            major = entry[7];
+            minor = entry[8];
+        } else if (entry.size() >= 8 && memcmp(entry.data(), "_SM_", 4) == 0) {
+            major = entry[6];
+            minor = entry[7];
+        }
+        return LoadSMBIOSTable(table.data(), static_cast<uint32_t>(table.size()), major, minor);
+    }
+
+    // Loads a structure table obtained elsewhere (a captured dump, a
+    // firmware image...), wrapped like a GetSystemFirmwareTable('RSMB') result.
+    inline bool LoadSMBIOSTable(const uint8_t* table, uint32_t size, uint8_t major, uint8_t minor) {
+        if (!table || size == 0) {
+            return false;
+        }
+        const uint32_t header_size = static_cast<uint32_t>(offsetof(RawSMBIOSData, smbios_table_data));
+        data_size = header_size + size;
+        raw_data = std::make_unique<uint8_t[]>(data_size + 512);
+
+        RawSMBIOSData* smbios_data = reinterpret_cast<RawSMBIOSData*>(raw_data.get());
+        smbios_data->calling_method = 0;
+        smbios_data->major_version = major;
+        smbios_data->minor_version = minor;
+        smbios_data->dmi_revision = 0;
+        smbios_data->length = size;
+        memcpy(raw_data.get() + header_size, table, size);
+        memset((raw_data.get() + data_size),0,512);
+        return true;
+    }
 
     inline bool ParseSMBIOSData() {
         if (!raw_data || data_size == 0) {
@@ -1415,6 +1477,7 @@ inline void ParseCacheInformation(const CacheInformation* cache) {
     }
     
     // Static helper methods
+#ifdef _WIN32
     inline static std::string GetLastErrorAsString() {
         DWORD errorMessageID = GetLastError();
         if (errorMessageID == 0) {
@@ -1431,6 +1494,14 @@ inline void ParseCacheInformation(const CacheInformation* cache) {
         LocalFree(messageBuffer);
         return message;
     }
+#else
+    inline static std::string GetLastErrorAsString() {
+        if (errno == 0) {
+            return "No error occurred";
+        }
+        return std::strerror(errno);
+    }
+#endif
 };
 } //name space SMBIOS
 } // namesapce HV
@@ -26,6 +26,9 @@
 #include "performance_monitor.h"
 #include "advanced_storage_info.h"
 #include "Smart_disk.h"
+#ifndef _WIN32
+#include "linux_helpers.h"
+#endif
 
 #ifdef BUILD_PYTHON_MODULE
 #define PY_SSIZE_T_CLEAN
@@ -709,6 +712,29 @@ static PyObject* py_get_smart_info_objects(PyObject* self, PyObject* args) {
     return result;
 }
 
+#ifndef _WIN32
+// Same sysroot as LiveView.set_sys_root(), which forwards to this one
+static PyObject* py_set_sys_root(PyObject* self, PyObject* args) {
+    const char* root;
+    if (!PyArg_ParseTuple(args, "s", &root)) {
+        return NULL;
+    }
+    if (hv_set_sys_root(root) != 0) {
+        PyErr_SetString(PyExc_ValueError, "Sysroot path is too long.");
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+static PyObject* py_get_sys_root(PyObject* self, PyObject* args) {
+    char* root = hv_get_sys_root();
+    if (!root) return PyErr_NoMemory();
+    PyObject* py_str = PyUnicode_DecodeFSDefault(root);
+    free(root);
+    return py_str;
+}
+#endif
+
 
 static PyMethodDef HardViewMethods[] = {
     {"get_bios_info", py_get_bios_info, METH_VARARGS, "Get BIOS information. Default is JSON string. Pass 0 for Python objects."},
@@ -749,6 +775,10 @@ static PyMethodDef HardViewMethods[] = {
     {"get_partitions_info_objects", py_get_partitions_info_objects, METH_VARARGS, "Get partitions info. Default is Python objects. Pass 1 for JSON string."},
     {"get_smart_info", py_get_smart_info, METH_NOARGS, "Get S.M.A.R.T. disk info as a JSON string."},
     {"get_smart_info_objects", py_get_smart_info_objects, METH_VARARGS, "Get S.M.A.R.T. disk info. Default is Python objects. Pass 1 for JSON string."},
+#ifndef _WIN32
+    {"set_sys_root", py_set_sys_root, METH_VARARGS, "Reads the /proc and /sys files of these functions under root instead of /. '' reads the live system again."},
+    {"get_sys_root", py_get_sys_root, METH_NOARGS, "Returns the sysroot of these functions, '' for the live system."},
+#endif
     {NULL, NULL, 0, NULL}
 };
 
@@ -250,6 +250,10 @@ PyObject* get_partitions_info_objects(bool Json) {
 }
 #endif
 
+#ifndef _WIN32
+static char* _scan_partitions_info(bool Json);
+#endif
+
 char* get_partitions_info(bool Json) {
 #ifdef _WIN32
     IWbemLocator *pLoc = NULL;
@@ -492,6 +496,13 @@ char* get_partitions_info(bool Json) {
 #endif
     }
 #else
+    // Linux: the scan is repeated only after a block device changes
+    return hv_cached_inventory("block", _scan_partitions_info, Json);
+#endif
+}
+
+#ifndef _WIN32
+static char* _scan_partitions_info(bool Json) {
     // Linux implementation - similar logic for JSON vs Python objects
     if (Json) {
         // Original Linux JSON implementation
@@ -550,5 +561,5 @@ char* get_partitions_info(bool Json) {
         return strdup("[]");
 #endif
     }
-#endif
 }
+#endif
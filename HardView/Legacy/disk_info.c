@@ -180,6 +180,10 @@ PyObject* get_disk_info_objects(bool Json) {
 }
 #endif
 
+#ifndef _WIN32
+static char* _scan_disk_info(bool Json);
+#endif
+
 char* get_disk_info(bool Json) {
 #ifdef _WIN32
     IWbemLocator *pLoc = NULL;
@@ -354,6 +358,13 @@ char* get_disk_info(bool Json) {
     }
 
 #else
+    // Linux: the scan is repeated only after a block device changes
+    return hv_cached_inventory("block", _scan_disk_info, Json);
+#endif
+}
+
+#ifndef _WIN32
+static char* _scan_disk_info(bool Json) {
     // Linux implementation
     if (Json) {
         // JSON mode - original implementation
@@ -416,5 +427,5 @@ char* get_disk_info(bool Json) {
         return strdup("[]");
 #endif
     }
-#endif
 }
+#endif
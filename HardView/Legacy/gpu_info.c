@@ -205,6 +205,10 @@ PyObject* get_gpu_info_objects(bool Json) {
 }
 #endif
 
+#ifndef _WIN32
+static char* _scan_gpu_info(bool Json);
+#endif
+
 char* get_gpu_info(bool Json) {
 #ifdef _WIN32
     IWbemLocator *pLoc = NULL;
@@ -379,6 +383,13 @@ char* get_gpu_info(bool Json) {
     }
 
 #else
+    // Linux: the scan is repeated only after a drm device changes
+    return hv_cached_inventory("drm", _scan_gpu_info, Json);
+#endif
+}
+
+#ifndef _WIN32
+static char* _scan_gpu_info(bool Json) {
     // Linux implementation
     if (Json) {
         // JSON mode - original implementation
@@ -441,5 +452,5 @@ char* gpu_mode        = _read_proc_sys_value("/sys/class/drm/card0/modes", "");
         return strdup("[]");
 #endif
     }
-#endif
 }
+#endif
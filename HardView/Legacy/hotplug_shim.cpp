@@ -0,0 +1,35 @@
+/*
+================================================================================
+ MIT License
+
+ Copyright (c) 2025 gafoo
+
+ This file is part of the HardView project:
+ https://github.com/gafoo173/HardView
+
+ Licensed under the MIT License.
+ See the LICENSE file in the project root for more details.
+================================================================================
+*/
+
+/*
+ * C entry point to the LiveView hotplug listener, so the C inventory
+ * functions can cache their scans the way the C++ headers do (see
+ * hv_cached_inventory() in linux_helpers.c).
+ */
+
+#include "linux_helpers.h"
+#include "../LiveView/include/Hotplug.hpp"
+
+#include <atomic>
+
+extern "C" unsigned long long hv_hotplug_generation(const char* subsystem) {
+    try {
+        return LiveView::HotplugMonitor::instance().generation(subsystem);
+    } catch (...) {
+        /* No exception may cross into C; a value never returned before
+           makes the caller rescan. */
+        static std::atomic<unsigned long long> failures{0};
+        return (1ULL << 63) | ++failures;
+    }
+}
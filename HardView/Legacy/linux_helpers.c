@@ -14,17 +14,259 @@
 
 
 #include "linux_helpers.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
+#include <unistd.h>
 
 #define MAX_INFO_LEN 1024
+#define MAX_PROC_FILE_LEN 8192
+#define PROC_CACHE_SIZE 16
 #define DMI_PATH_PREFIX "/sys/class/dmi/id/"
 
+/*
+ * Small cache of open procfs/sysfs descriptors. Both filesystems regenerate
+ * a file when it is read again from offset 0, so re-reading with pread()
+ * saves an open()/close() pair and a path lookup per value. The least
+ * recently used descriptor is closed when the cache is full, and one that
+ * fails with ENODEV (device removed) is reopened once by path.
+ */
+typedef struct {
+    char path[MAX_INFO_LEN];
+    int fd;
+    unsigned long last_used;
+} _proc_cache_entry;
+
+static _proc_cache_entry _proc_cache[PROC_CACHE_SIZE];
+static int _proc_cache_count = 0;
+static unsigned long _proc_cache_clock = 0;
+static pthread_mutex_t _proc_cache_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/*
+ * Prefix of every procfs/sysfs path, without a trailing '/' ("" reads the
+ * live system). Taken from HARDVIEW_SYSROOT on first use unless
+ * hv_set_sys_root() was called before. Guarded by _proc_cache_lock.
+ */
+static char _sys_root[MAX_INFO_LEN];
+static int _sys_root_loaded = 0;
+static unsigned long _sys_root_epoch = 0; /* Bumped on every change */
+
+static void _set_sys_root_locked(const char* root, size_t len) {
+    int i;
+    while (len > 0 && root[len - 1] == '/') len--;
+    memcpy(_sys_root, root, len);
+    _sys_root[len] = '\0';
+    _sys_root_loaded = 1;
+    _sys_root_epoch++;
+    /* Descriptors of the previous root must not outlive it. */
+    for (i = 0; i < _proc_cache_count; i++) close(_proc_cache[i].fd);
+    _proc_cache_count = 0;
+}
+
+/* Writes the sysroot followed by path into out; -1 if it does not fit. */
+static int _sys_path_locked(const char* path, char* out, size_t size) {
+    int n;
+    if (!_sys_root_loaded) {
+        const char* env = getenv("HARDVIEW_SYSROOT");
+        size_t len = env ? strlen(env) : 0;
+        if (len >= MAX_INFO_LEN) len = 0; /* Unusable: read the live system */
+        _set_sys_root_locked(len ? env : "", len);
+    }
+    n = snprintf(out, size, "%s%s", _sys_root, path);
+    return (n < 0 || (size_t)n >= size) ? -1 : 0;
+}
+
+int hv_set_sys_root(const char* root) {
+    size_t len = root ? strlen(root) : 0;
+    if (len >= MAX_INFO_LEN) return -1;
+    pthread_mutex_lock(&_proc_cache_lock);
+    _set_sys_root_locked(root ? root : "", len);
+    pthread_mutex_unlock(&_proc_cache_lock);
+    return 0;
+}
+
+char* hv_get_sys_root(void) {
+    char root[MAX_INFO_LEN];
+    pthread_mutex_lock(&_proc_cache_lock);
+    _sys_path_locked("", root, sizeof(root));
+    pthread_mutex_unlock(&_proc_cache_lock);
+    return strdup(root);
+}
+
+/*
+ * Inventory results cached by hv_cached_inventory(), one per scan function
+ * and output mode. Guarded by _inventory_lock; the scans run unlocked.
+ */
+#ifdef __linux__
+#define INVENTORY_CACHE_SIZE 16
+
+typedef struct {
+    hv_inventory_scan scan;
+    bool json;
+    char* value;
+    unsigned long long generation;
+    unsigned long root_epoch;
+    time_t filled; /* CLOCK_MONOTONIC seconds */
+} _inventory_entry;
+
+static _inventory_entry _inventory[INVENTORY_CACHE_SIZE];
+static int _inventory_count = 0;
+static pthread_mutex_t _inventory_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static time_t _monotonic_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec;
+}
+
+char* hv_cached_inventory(const char* subsystem, hv_inventory_scan scan, bool Json) {
+    unsigned long long generation = hv_hotplug_generation(subsystem);
+    unsigned long root_epoch;
+    time_t now = _monotonic_seconds();
+    _inventory_entry* entry = NULL;
+    char* value;
+    int i;
+
+    pthread_mutex_lock(&_proc_cache_lock);
+    root_epoch = _sys_root_epoch;
+    pthread_mutex_unlock(&_proc_cache_lock);
+
+    pthread_mutex_lock(&_inventory_lock);
+    for (i = 0; i < _inventory_count; i++) {
+        if (_inventory[i].scan == scan && _inventory[i].json == Json) {
+            entry = &_inventory[i];
+            break;
+        }
+    }
+    if (entry && entry->generation == generation && entry->root_epoch == root_epoch &&
+        now - entry->filled < HV_INVENTORY_MAX_AGE_SEC) {
+        value = strdup(entry->value);
+        pthread_mutex_unlock(&_inventory_lock);
+        return value;
+    }
+    pthread_mutex_unlock(&_inventory_lock);
+
+    /* The generation was read before the scan: a change during the scan
+       makes the next call rescan. */
+    value = scan(Json);
+    if (value == NULL || strncmp(value, "{\"error\"", 8) == 0) return value;
+
+    pthread_mutex_lock(&_inventory_lock);
+    entry = NULL;
+    for (i = 0; i < _inventory_count; i++) {
+        if (_inventory[i].scan == scan && _inventory[i].json == Json) {
+            entry = &_inventory[i];
+            break;
+        }
+    }
+    if (entry == NULL && _inventory_count < INVENTORY_CACHE_SIZE) {
+        entry = &_inventory[_inventory_count++];
+        entry->scan = scan;
+        entry->json = Json;
+        entry->value = NULL;
+    }
+    if (entry) {
+        char* copy = strdup(value);
+        if (copy) {
+            free(entry->value);
+            entry->value = copy;
+            entry->generation = generation;
+            entry->root_epoch = root_epoch;
+            entry->filled = now;
+        } else if (entry->value == NULL) {
+            *entry = _inventory[--_inventory_count];
+        }
+    }
+    pthread_mutex_unlock(&_inventory_lock);
+    return value;
+}
+#else
+char* hv_cached_inventory(const char* subsystem, hv_inventory_scan scan, bool Json) {
+    /* No hotplug events to invalidate the cache with */
+    (void)subsystem;
+    return scan(Json);
+}
+#endif
+
+static ssize_t _pread_whole(int fd, char* buffer, size_t size) {
+    size_t used = 0;
+    while (used < size - 1) {
+        ssize_t n = pread(fd, buffer + used, size - 1 - used, (off_t)used);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return -1;
+        }
+        if (n == 0) break;
+        used += (size_t)n;
+    }
+    buffer[used] = '\0';
+    return (ssize_t)used;
+}
+
+/*
+ * Reads up to size - 1 bytes of a file through the descriptor cache.
+ * path is the live-system path; the sysroot is prepended here.
+ */
+static ssize_t _proc_cache_read(const char* live_path, char* buffer, size_t size) {
+    ssize_t n = -1;
+    int i;
+    _proc_cache_entry* entry = NULL;
+    char path[MAX_INFO_LEN];
+
+    pthread_mutex_lock(&_proc_cache_lock);
+    if (_sys_path_locked(live_path, path, sizeof(path)) < 0) goto out;
+    for (i = 0; i < _proc_cache_count; i++) {
+        if (strcmp(_proc_cache[i].path, path) == 0) {
+            entry = &_proc_cache[i];
+            break;
+        }
+    }
+    if (entry == NULL) {
+        int fd = open(path, O_RDONLY | O_CLOEXEC);
+        if (fd < 0) goto out;
+        if (_proc_cache_count < PROC_CACHE_SIZE) {
+            entry = &_proc_cache[_proc_cache_count++];
+        } else {
+            entry = &_proc_cache[0];
+            for (i = 1; i < PROC_CACHE_SIZE; i++) {
+                if (_proc_cache[i].last_used < entry->last_used) entry = &_proc_cache[i];
+            }
+            close(entry->fd);
+        }
+        strcpy(entry->path, path);
+        entry->fd = fd;
+    }
+    entry->last_used = ++_proc_cache_clock;
+
+    n = _pread_whole(entry->fd, buffer, size);
+    if (n < 0 && errno == ENODEV) {
+        close(entry->fd);
+        entry->fd = open(path, O_RDONLY | O_CLOEXEC);
+        if (entry->fd >= 0) n = _pread_whole(entry->fd, buffer, size);
+    }
+    if (n < 0) {
+        /* Drop the entry; the next call retries from scratch. */
+        if (entry->fd >= 0) close(entry->fd);
+        *entry = _proc_cache[--_proc_cache_count];
+    }
+out:
+    pthread_mutex_unlock(&_proc_cache_lock);
+    return n;
+}
+
 char* _read_dmi_attribute_linux(const char* attribute_name) {
+    char live_path[MAX_INFO_LEN];
     char path[MAX_INFO_LEN];
-    snprintf(path, sizeof(path), "%s%s", DMI_PATH_PREFIX, attribute_name);
-    FILE* fp = fopen(path, "r");
+    int fits;
+    snprintf(live_path, sizeof(live_path), "%s%s", DMI_PATH_PREFIX, attribute_name);
+    pthread_mutex_lock(&_proc_cache_lock);
+    fits = _sys_path_locked(live_path, path, sizeof(path)) == 0;
+    pthread_mutex_unlock(&_proc_cache_lock);
+    FILE* fp = fits ? fopen(path, "r") : NULL;
     if (fp == NULL) {
         return strdup("N/A");
     }
@@ -43,24 +285,27 @@ char* _read_dmi_attribute_linux(const char* attribute_name) {
 }
 
 char* _read_proc_sys_value(const char* path, const char* key) {
-    FILE* fp = fopen(path, "r");
-    if (fp == NULL) {
+    char contents[MAX_PROC_FILE_LEN];
+    if (_proc_cache_read(path, contents, sizeof(contents)) < 0) {
         return strdup("N/A");
     }
-    char line[MAX_INFO_LEN];
     char* value = strdup("N/A");
-    while (fgets(line, sizeof(line), fp) != NULL) {
+    char* line = contents;
+    while (line != NULL && *line != '\0') {
+        char* next = strchr(line, '\n');
+        if (next) *next++ = '\0';
         if (strlen(key) == 0 || strstr(line, key) == line) {
             char* start = line;
             if (strlen(key) > 0) {
                 start = strchr(line, ':');
-                if (!start) continue;
+                if (!start) { line = next; continue; }
                 start += 1;
             }
             while (*start == ' ' || *start == '\t') start++;
             size_t end_ptr = strcspn(start, "\n");
             if (end_ptr > 0) {
                 char temp[MAX_INFO_LEN];
+                if (end_ptr >= sizeof(temp)) end_ptr = sizeof(temp) - 1;
                 strncpy(temp, start, end_ptr);
                 temp[end_ptr] = '\0';
                 free(value);
@@ -68,7 +313,7 @@ char* _read_proc_sys_value(const char* path, const char* key) {
                 break;
             }
         }
+        line = next;
     }
-    fclose(fp);
     return value;
 }
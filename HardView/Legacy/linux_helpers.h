@@ -20,4 +20,38 @@
 char* _read_dmi_attribute_linux(const char* attribute_name);
 char* _read_proc_sys_value(const char* path, const char* key);
 
+/*
+ * Reads every procfs/sysfs path above under root instead of / (the
+ * HARDVIEW_SYSROOT environment variable by default). NULL or "" selects the
+ * live system. Returns -1 if root is too long.
+ */
+int hv_set_sys_root(const char* root);
+/* The current sysroot; the caller frees the returned string. */
+char* hv_get_sys_root(void);
+
+/*
+ * Returns scan(Json), served from a cache until a device of the given
+ * hotplug subsystem ("block", "drm", ...) is added, removed or changed, the
+ * sysroot changes, or the value is HV_INVENTORY_MAX_AGE_SEC old. Error
+ * results ({"error": ...}) are not cached. The caller frees the returned
+ * string, as with scan() itself. Thread-safe.
+ */
+#define HV_INVENTORY_MAX_AGE_SEC 300
+typedef char* (*hv_inventory_scan)(bool Json);
+char* hv_cached_inventory(const char* subsystem, hv_inventory_scan scan, bool Json);
+
+#ifdef __linux__
+#ifdef __cplusplus
+extern "C" {
+#endif
+/*
+ * Change counter of a hotplug subsystem (hotplug_shim.cpp, over the
+ * LiveView HotplugMonitor). Equal values mean nothing changed in between.
+ */
+unsigned long long hv_hotplug_generation(const char* subsystem);
+#ifdef __cplusplus
+}
+#endif
+#endif
+
 #endif // LINUX_HELPERS_H 
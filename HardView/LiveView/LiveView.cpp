@@ -36,9 +36,20 @@
 #include <vector>
 #include <map>
 #include <cmath>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <cstring>
+#include <functional>
+#include <tuple>
 #ifndef LIVEVIEW_CPP
 // --- pybind11 Includes ---
 #include <pybind11/chrono.h>
+#include <pybind11/functional.h>
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
@@ -47,6 +58,9 @@
 // --- HardView Includes ---
 #include "../../cpuid/cpuid.hpp"
 #include "../../cpuid/cpuidHelpers.hpp"
+#include "include/CollectorStats.hpp"
+#include "include/SampleRing.hpp"
+#include "include/TimerQueue.hpp"
 #ifdef _WIN32
 #include "include/HardwareTemp.h" //For Hardware temperature
 #include "../../C++/Headers/WMI/WMI_info.hpp"
@@ -70,8 +84,17 @@
 #include <map>
 #include <numeric>
 #include <sstream>
-#include <sensors/sensors.h>
 #include <unistd.h>
+#include "include/ProcReader.hpp"
+#include "include/ProcStats.hpp"
+#include "include/NetlinkStats.hpp"
+#include "include/HwmonSensors.hpp"
+#include "include/SensorSession.hpp"
+#include "include/Recording.hpp"
+#include "include/MetricsExporter.hpp"
+#include "include/SharedMetrics.hpp"
+#include "include/CpuFreq.hpp"
+#include "include/Pressure.hpp"
 #endif
 #ifndef LIVEVIEW_CPP
 namespace py = pybind11;
@@ -84,6 +107,35 @@ namespace py = pybind11;
 // HELPER FUNCTIONS
 // ===================================================================================
 
+#ifndef LIVEVIEW_CPP
+/**
+ * @brief Registers a NumPy structured dtype the first time a method that
+ * returns one is called, so importing the module does not need NumPy.
+ * @param once One flag per registered type.
+ * @param reg Runs PYBIND11_NUMPY_DTYPE for the type.
+ * @throws ImportError If NumPy is not installed (the registration is retried
+ * on the next call).
+ */
+template <typename Register>
+void register_numpy_dtype(std::once_flag& once, Register reg) {
+  py::gil_scoped_release release; // A waiter must not hold the GIL
+  std::call_once(once, [&] {
+    py::gil_scoped_acquire acquire;
+    try {
+      py::module_::import("numpy");
+    }
+    catch (py::error_already_set& e) {
+      if (!e.matches(PyExc_ImportError))
+        throw;
+      PyErr_SetString(PyExc_ImportError,
+        "This method requires NumPy (pip install numpy).");
+      throw py::error_already_set();
+    }
+    reg();
+  });
+}
+#endif
+
 #ifdef _WIN32
 /**
  * @brief Converts a wide-character string (wstring) to a UTF-8 encoded string.
@@ -167,258 +219,531 @@ struct CpuTimes {
   long long user, nice, system, idle, iowait, irq, softirq, steal;
 };
 
-CpuTimes get_cpu_times() {
-  std::ifstream proc_stat("/proc/stat");
-  if (!proc_stat.is_open())
-    throw std::runtime_error("Failed to open /proc/stat.");
-  proc_stat.ignore(5, ' '); // Ignore "cpu "
+/**
+ * @brief Parses the aggregate "cpu" line of the content of /proc/stat.
+ */
+CpuTimes parse_cpu_times(const char* p, const char* end) {
+  p += end - p > 4 ? 4 : end - p; // Skip "cpu "
   CpuTimes times{};
-  proc_stat >> times.user >> times.nice >> times.system >> times.idle >>
-    times.iowait >> times.irq >> times.softirq >> times.steal;
+  times.user = LiveView::scan_ll(p, end);
+  times.nice = LiveView::scan_ll(p, end);
+  times.system = LiveView::scan_ll(p, end);
+  times.idle = LiveView::scan_ll(p, end);
+  times.iowait = LiveView::scan_ll(p, end);
+  times.irq = LiveView::scan_ll(p, end);
+  times.softirq = LiveView::scan_ll(p, end);
+  times.steal = LiveView::scan_ll(p, end);
   return times;
 }
 
+CpuTimes get_cpu_times() {
+  LiveView::CollectorTimer timer(LiveView::COLLECTOR_CPU);
+  static thread_local std::string buffer; // Reused between calls
+  if (!LiveView::read_proc_file("/proc/stat", buffer))
+    throw std::runtime_error("Failed to open /proc/stat.");
+  return parse_cpu_times(buffer.data(), buffer.data() + buffer.size());
+}
+
 long long get_idle_time(const CpuTimes& t) { return t.idle + t.iowait; }
 long long get_total_time(const CpuTimes& t) {
   return t.user + t.nice + t.system + t.idle + t.iowait + t.irq + t.softirq +
     t.steal;
 }
 
-struct DiskStats {
-  long long sectors_read;
-  long long sectors_written;
-};
+/**
+ * @brief Computes the CPU usage percentage between two /proc/stat snapshots.
+ */
+double calc_cpu_usage(const CpuTimes& start, const CpuTimes& end) {
+  long long idle_delta = get_idle_time(end) - get_idle_time(start);
+  long long total_delta = get_total_time(end) - get_total_time(start);
 
-std::map<std::string, DiskStats> get_disk_stats() {
-  std::ifstream file("/proc/diskstats");
-  if (!file.is_open())
-    throw std::runtime_error("Failed to open /proc/diskstats.");
-  std::map<std::string, DiskStats> stats;
-  std::string line;
-  while (std::getline(file, line)) {
-    std::stringstream ss(line);
-    int major, minor;
-    std::string device_name;
-    long long reads, reads_merged, sectors_read, time_reading, writes,
-      writes_merged, sectors_written;
-    ss >> major >> minor >> device_name >> reads >> reads_merged >>
-      sectors_read >> time_reading >> writes >> writes_merged >>
-      sectors_written;
-    if (isdigit(device_name.back()))
-      continue; // Skip partitions
-    stats[device_name] = { sectors_read, sectors_written };
-  }
-  return stats;
+  if (total_delta == 0)
+    return 0.0;
+  return (1.0 - static_cast<double>(idle_delta) / total_delta) * 100.0;
 }
 
-struct NetworkStats {
-  long long bytes_received;
-  long long bytes_transmitted;
-};
+/**
+ * @brief Stores CPU times in the CPU block of a recording frame.
+ */
+void record_cpu_times(const CpuTimes& t, LiveView::RecordedFrame& frame) {
+  const long long values[8] = { t.user, t.nice, t.system, t.idle, t.iowait,
+    t.irq, t.softirq, t.steal };
+  std::copy(values, values + 8, frame.cpu);
+  frame.sections |= LiveView::RECORD_CPU;
+}
 
-std::map<std::string, NetworkStats> get_network_stats() {
-  std::ifstream file("/proc/net/dev");
-  if (!file.is_open())
-    throw std::runtime_error("Failed to open /proc/net/dev.");
-  std::map<std::string, NetworkStats> stats;
-  std::string line;
-  std::getline(file, line); // Skip header line 1
-  std::getline(file, line); // Skip header line 2
-  while (std::getline(file, line)) {
-    std::stringstream ss(line);
-    std::string iface_name;
-    long long recv_bytes, trans_bytes;
-    ss >> iface_name >> recv_bytes;
-    // Skip intermediate columns to get to transmitted bytes
-    for (int i = 0; i < 7; ++i)
-      ss.ignore(256, ' ');
-    ss >> trans_bytes;
-
-    if (iface_name.back() == ':')
-      iface_name.pop_back();
-    if (iface_name == "lo")
-      continue; // Skip loopback
-    stats[iface_name] = { recv_bytes, trans_bytes };
-  }
-  return stats;
+/**
+ * @brief Reads CPU times back from the CPU block of a recording frame.
+ */
+CpuTimes replay_cpu_times(const LiveView::RecordedFrame& frame) {
+  const long long* c = frame.cpu;
+  return CpuTimes{ c[0], c[1], c[2], c[3], c[4], c[5], c[6], c[7] };
 }
-//Temperature For Linux
 
-inline double GetSensorTempByKeywords(const std::vector<std::string>& keywords, const std::vector<std::string>& MatchKeyWords = {}) {
-  double temp = -1.0;
+// Number of values per core returned by get_per_core_usage():
+// user, system, iowait, irq, softirq, steal
+#define CPU_CORE_FIELDS 6
+
+/**
+ * @brief Parses every "cpuN" line of /proc/stat in a single pass.
+ * @param buffer Reusable read buffer.
+ * @param cores Output counters indexed by core number. Only reallocated when
+ * the highest core number grows, so repeated calls do not allocate.
+ */
+void get_per_core_cpu_times(std::string& buffer, std::vector<CpuTimes>& cores) {
+  LiveView::CollectorTimer timer(LiveView::COLLECTOR_CPU);
+  if (!LiveView::read_proc_file("/proc/stat", buffer))
+    throw std::runtime_error("Failed to open /proc/stat.");
 
-  if (sensors_init(nullptr) != 0) {
-    throw std::runtime_error("Failed to initialize sensors.");
+  const char* p = buffer.data();
+  const char* end = p + buffer.size();
+  size_t count = 0;
+  while (p < end) {
+    if (end - p > 3 && p[0] == 'c' && p[1] == 'p' && p[2] == 'u') {
+      p += 3;
+      if (*p >= '0' && *p <= '9') {
+        size_t core = static_cast<size_t>(LiveView::scan_ll(p, end));
+        if (core >= cores.size())
+          cores.resize(core + 1);
+        CpuTimes& t = cores[core];
+        t.user = LiveView::scan_ll(p, end);
+        t.nice = LiveView::scan_ll(p, end);
+        t.system = LiveView::scan_ll(p, end);
+        t.idle = LiveView::scan_ll(p, end);
+        t.iowait = LiveView::scan_ll(p, end);
+        t.irq = LiveView::scan_ll(p, end);
+        t.softirq = LiveView::scan_ll(p, end);
+        t.steal = LiveView::scan_ll(p, end);
+        if (core + 1 > count)
+          count = core + 1;
+      }
+    }
+    else if (count > 0) {
+      break; // The cpuN lines are contiguous at the top of the file
+    }
+    p = LiveView::next_line(p, end);
   }
+  cores.resize(count);
+}
 
-  const sensors_chip_name* chip;
-  int chip_nr = 0;
+/**
+ * @brief Computes per-core utilisation between two per-core snapshots.
+ * @param out Flat output of CPU_CORE_FIELDS percentages per core. Nice time
+ * is counted as user time.
+ */
+void calc_per_core_usage(const std::vector<CpuTimes>& start,
+  const std::vector<CpuTimes>& end, std::vector<double>& out) {
+  out.assign(end.size() * CPU_CORE_FIELDS, 0.0);
+  size_t n = start.size() < end.size() ? start.size() : end.size();
+  for (size_t i = 0; i < n; ++i) {
+    const CpuTimes& s = start[i];
+    const CpuTimes& e = end[i];
+    long long total_delta = get_total_time(e) - get_total_time(s);
+    if (total_delta <= 0)
+      continue;
+    double scale = 100.0 / static_cast<double>(total_delta);
+    double* row = &out[i * CPU_CORE_FIELDS];
+    row[0] = ((e.user + e.nice) - (s.user + s.nice)) * scale;
+    row[1] = (e.system - s.system) * scale;
+    row[2] = (e.iowait - s.iowait) * scale;
+    row[3] = (e.irq - s.irq) * scale;
+    row[4] = (e.softirq - s.softirq) * scale;
+    row[5] = (e.steal - s.steal) * scale;
+  }
+}
 
-  while ((chip = sensors_get_detected_chips(nullptr, &chip_nr)) != nullptr) {
-    const sensors_feature* feature;
-    int feature_nr = 0;
+using LiveView::DiskStats;
+using LiveView::NetworkStats;
+using LiveView::get_disk_stats;
+using LiveView::get_network_stats;
 
-    while ((feature = sensors_get_features(chip, &feature_nr)) != nullptr) {
-      const char* feature_label = sensors_get_label(chip, feature);
-      if (!feature_label) continue;
+/**
+ * @brief Computes aggregate read/write speed over the last two parses of a
+ * disk table. Only physical disks are counted, so I/O to a partition, an md
+ * array or a loop device is not counted twice.
+ * @param interval_sec The time between the two parses in seconds.
+ */
+std::vector<std::pair<std::string, double>>
+calc_disk_rates(const LiveView::DeviceTable<DiskStats>& table,
+  double interval_sec) {
+  long long total_sectors_read = 0;
+  long long total_sectors_written = 0;
+  for (size_t i = 0; i < table.size(); ++i) {
+    const auto& e = table[i];
+    if (e.present && e.hasPrevious && e.value.physical) {
+      total_sectors_read += e.value.sectors_read - e.previous.sectors_read;
+      total_sectors_written +=
+        e.value.sectors_written - e.previous.sectors_written;
+    }
+  }
+  double read_MBps = 0.0, write_MBps = 0.0;
+  if (interval_sec > 0.0) {
+    read_MBps = (total_sectors_read * 512.0) / (1024.0 * 1024.0) / interval_sec;
+    write_MBps =
+      (total_sectors_written * 512.0) / (1024.0 * 1024.0) / interval_sec;
+  }
+  return std::vector<std::pair<std::string, double>>{
+    {"Read MB/s", read_MBps}, { "Write MB/s", write_MBps }};
+}
 
-      std::string label = feature_label;
+/**
+ * @struct DiskDeviceStats
+ * @brief Block I/O metrics of one whole disk over one interval (Linux).
+ */
+struct DiskDeviceStats {
+  std::string name;
+  double read_iops = 0;            // Reads completed per second
+  double write_iops = 0;           // Writes completed per second
+  double read_merged_per_sec = 0;  // Reads merged per second
+  double write_merged_per_sec = 0; // Writes merged per second
+  double read_MBps = 0;
+  double write_MBps = 0;
+  double read_await_ms = 0;  // Average time per completed read
+  double write_await_ms = 0; // Average time per completed write
+  double avg_queue_size = 0; // Average number of I/Os in progress
+  long long in_flight = 0;   // I/Os in progress at the end of the interval
+  double busy_percent = 0;   // Share of the interval with I/O in progress
+};
 
-      bool match = false;
-      if (!MatchKeyWords.empty()) {
-        for (const auto& key : MatchKeyWords) {
-          if (label == key) {
-            match = true;
-            break;
-          }
-        }
-      }
-      for (const auto& key : keywords) {
-        if (label == key || label.find(key) != std::string::npos) {
-          match = true;
-          break;
-        }
-      }
+/**
+ * @brief Computes per-device metrics over the last two parses of a disk
+ * table. Lists every whole disk (NVMe, md, dm and loop devices included),
+ * but not partitions.
+ * @param interval_sec The time between the two parses in seconds.
+ */
+std::vector<DiskDeviceStats>
+calc_disk_device_stats(const LiveView::DeviceTable<DiskStats>& table,
+  double interval_sec) {
+  std::vector<DiskDeviceStats> result;
+  for (size_t i = 0; i < table.size(); ++i) {
+    const auto& e = table[i];
+    if (!e.present || !e.value.whole_disk)
+      continue;
+    DiskDeviceStats d;
+    d.name = e.name;
+    d.in_flight = e.value.in_flight;
+    if (e.hasPrevious && interval_sec > 0.0) {
+      const DiskStats& s = e.previous;
+      const DiskStats& c = e.value;
+      long long reads = c.reads - s.reads;
+      long long writes = c.writes - s.writes;
+      d.read_iops = reads / interval_sec;
+      d.write_iops = writes / interval_sec;
+      d.read_merged_per_sec = (c.reads_merged - s.reads_merged) / interval_sec;
+      d.write_merged_per_sec =
+        (c.writes_merged - s.writes_merged) / interval_sec;
+      d.read_MBps = ((c.sectors_read - s.sectors_read) * 512.0) /
+        (1024.0 * 1024.0) / interval_sec;
+      d.write_MBps = ((c.sectors_written - s.sectors_written) * 512.0) /
+        (1024.0 * 1024.0) / interval_sec;
+      if (reads > 0)
+        d.read_await_ms = static_cast<double>(c.read_ms - s.read_ms) / reads;
+      if (writes > 0)
+        d.write_await_ms =
+          static_cast<double>(c.write_ms - s.write_ms) / writes;
+      double interval_ms = interval_sec * 1000.0;
+      d.avg_queue_size = (c.weighted_io_ms - s.weighted_io_ms) / interval_ms;
+      d.busy_percent = (c.io_ms - s.io_ms) / interval_ms * 100.0;
+      if (d.busy_percent > 100.0)
+        d.busy_percent = 100.0;
+    }
+    result.push_back(std::move(d));
+  }
+  return result;
+}
 
-      if (match) {
-        const sensors_subfeature* sub;
-        int sub_nr = 0;
-        while ((sub = sensors_get_all_subfeatures(chip, feature, &sub_nr)) != nullptr) {
-          if (sub->flags & SENSORS_MODE_R) {
-            double value;
-            if (sensors_get_value(chip, sub->number, &value) == 0) {
-              temp = value;
-              if (temp != -1.0) {
-                sensors_cleanup();
-                return temp;
-              }
-              break;
-            }
-          }
-        }
-      }
+/**
+ * @brief Computes network speed over the last two parses of an interface
+ * table.
+ * @param interval_sec The time between the two parses in seconds.
+ * @param mode 0 for total speed (MB/s), 1 for per-interface speed (MB/s).
+ */
+std::variant<double, std::vector<std::pair<std::string, double>>>
+calc_network_usage(const LiveView::DeviceTable<NetworkStats>& table,
+  double interval_sec, int mode) {
+  if (interval_sec <= 0.0)
+    interval_sec = 1.0; // No elapsed time yet: deltas are zero anyway
+
+  if (mode == 0) {
+    long long total_bytes_delta = 0;
+    for (size_t i = 0; i < table.size(); ++i)
+      total_bytes_delta += LiveView::network_bytes_delta(table[i]);
+    return (total_bytes_delta) / (1024.0 * 1024.0) / interval_sec;
+  }
+  else { // mode == 1
+    std::vector<std::pair<std::string, double>> result;
+    result.reserve(table.size());
+    for (size_t i = 0; i < table.size(); ++i) {
+      if (!table[i].present)
+        continue;
+      long long bytes_delta = LiveView::network_bytes_delta(table[i]);
+      result.emplace_back(table[i].name,
+        (bytes_delta) / (1024.0 * 1024.0) / interval_sec);
     }
+    return result;
   }
+}
+
+/**
+ * @struct NetInterfaceStats
+ * @brief Traffic of one network interface over one interval (Linux).
+ * All values are per second.
+ */
+struct NetInterfaceStats {
+  std::string name;
+  double rx_MBps = 0;
+  double tx_MBps = 0;
+  double rx_packets = 0;
+  double tx_packets = 0;
+  double rx_errors = 0;
+  double tx_errors = 0;
+  double rx_drops = 0;
+  double tx_drops = 0;
+};
 
-  sensors_cleanup();
-  return temp;
+/**
+ * @brief Computes per-interface rates over the last two reads of an
+ * interface table.
+ * @param interval_sec The time between the two reads in seconds.
+ */
+std::vector<NetInterfaceStats>
+calc_interface_stats(const LiveView::DeviceTable<NetworkStats>& table,
+  double interval_sec) {
+  std::vector<NetInterfaceStats> result;
+  result.reserve(table.size());
+  for (size_t i = 0; i < table.size(); ++i) {
+    const auto& e = table[i];
+    if (!e.present)
+      continue;
+    NetInterfaceStats n;
+    n.name = e.name;
+    if (e.hasPrevious && interval_sec > 0.0) {
+      const NetworkStats& s = e.previous;
+      const NetworkStats& c = e.value;
+      n.rx_MBps = (c.bytes_received - s.bytes_received) / (1024.0 * 1024.0) /
+        interval_sec;
+      n.tx_MBps = (c.bytes_transmitted - s.bytes_transmitted) /
+        (1024.0 * 1024.0) / interval_sec;
+      n.rx_packets = (c.packets_received - s.packets_received) / interval_sec;
+      n.tx_packets =
+        (c.packets_transmitted - s.packets_transmitted) / interval_sec;
+      n.rx_errors = (c.errors_received - s.errors_received) / interval_sec;
+      n.tx_errors = (c.errors_transmitted - s.errors_transmitted) / interval_sec;
+      n.rx_drops = (c.drops_received - s.drops_received) / interval_sec;
+      n.tx_drops = (c.drops_transmitted - s.drops_transmitted) / interval_sec;
+    }
+    result.push_back(std::move(n));
+  }
+  return result;
 }
-inline double GetCpuPackageTemp() {
-  return GetSensorTempByKeywords({
+//Temperature For Linux
+
+/**
+ * @brief Reads the first sensor whose label matches, through the shared
+ * sensor session.
+ * @param keywords Substrings to look for in the sensor labels.
+ * @param MatchKeyWords Labels that must match exactly.
+ * @return The value, or -1 if no matching sensor could be read.
+ */
+inline double GetSensorTempByKeywords(const std::vector<std::string>& keywords, const std::vector<std::string>& MatchKeyWords = {}) {
+  LiveView::SensorQuery query(keywords, MatchKeyWords);
+  return LiveView::SensorSession::instance().read(query);
+}
+
+// Label keywords of the well-known temperatures.
+inline LiveView::SensorQuery CpuPackageTempQuery() {
+  return LiveView::SensorQuery({
       "Package id", "Physical id", "Tdie"
     });
 }
 
-inline double GetMotherboardTemp() {
-  return GetSensorTempByKeywords(
+inline LiveView::SensorQuery MotherboardTempQuery() {
+  return LiveView::SensorQuery(
     { "MB ", "SYSTIN", "System", "Board" },
     { "temp1" });
 }
 
-inline double GetVRMTemp() {
-  return GetSensorTempByKeywords({
+inline LiveView::SensorQuery VRMTempQuery() {
+  return LiveView::SensorQuery({
       "VRM"
     });
 }
 
-inline double GetChipsetTemp() {
-  return GetSensorTempByKeywords({
+inline LiveView::SensorQuery ChipsetTempQuery() {
+  return LiveView::SensorQuery({
       "PCH", "Chipset"
     });
 }
 
-inline double GetDIMMTemp() {
-  return GetSensorTempByKeywords({
+inline LiveView::SensorQuery DIMMTempQuery() {
+  return LiveView::SensorQuery({
       "DIMM", "Memory"
     });
 }
 
-inline double GetDriveTemp() {
-  return GetSensorTempByKeywords({
+inline LiveView::SensorQuery DriveTempQuery() {
+  return LiveView::SensorQuery({
       "drive", "HDD", "SSD", "nvme"
     });
 }
 
+// The queries below are resolved once per session, so after the first call
+// a read is just the sensors_get_value() or pread() of the matched features.
+inline double GetCpuPackageTemp() {
+  static LiveView::SensorQuery query = CpuPackageTempQuery();
+  return LiveView::SensorSession::instance().read(query);
+}
 
-inline double GetSensorByName(const std::string& sensorName, bool exactMatch) {
-  double temp = -1.0;
-
-  if (sensors_init(nullptr) != 0) {
-    throw std::runtime_error("Failed to initialize sensors");
-  }
-
-  const sensors_chip_name* chip;
-  int chip_nr = 0;
+inline double GetMotherboardTemp() {
+  static LiveView::SensorQuery query = MotherboardTempQuery();
+  return LiveView::SensorSession::instance().read(query);
+}
 
-  while ((chip = sensors_get_detected_chips(nullptr, &chip_nr)) != nullptr) {
-    const sensors_feature* feature;
-    int feature_nr = 0;
+inline double GetVRMTemp() {
+  static LiveView::SensorQuery query = VRMTempQuery();
+  return LiveView::SensorSession::instance().read(query);
+}
 
-    while ((feature = sensors_get_features(chip, &feature_nr)) != nullptr) {
-      const char* feature_label = sensors_get_label(chip, feature);
-      if (!feature_label) continue;
+inline double GetChipsetTemp() {
+  static LiveView::SensorQuery query = ChipsetTempQuery();
+  return LiveView::SensorSession::instance().read(query);
+}
 
-      std::string label = feature_label;
-      bool match = false;
+inline double GetDIMMTemp() {
+  static LiveView::SensorQuery query = DIMMTempQuery();
+  return LiveView::SensorSession::instance().read(query);
+}
 
-      if (exactMatch) {
-        match = (label == sensorName);
-      }
-      else {
-        match = (label.find(sensorName) != std::string::npos);
-      }
+inline double GetDriveTemp() {
+  static LiveView::SensorQuery query = DriveTempQuery();
+  return LiveView::SensorSession::instance().read(query);
+}
 
-      if (match) {
-        const sensors_subfeature* sub;
-        int sub_nr = 0;
-        while ((sub = sensors_get_all_subfeatures(chip, feature, &sub_nr)) != nullptr) {
-          if (sub->flags & SENSORS_MODE_R) {
-            double value;
-            if (sensors_get_value(chip, sub->number, &value) == 0) {
-              temp = value;
-              if (temp != -1.0) {
-                sensors_cleanup();
-                return temp;
-              }
-              break;
-            }
-          }
-        }
-      }
-    }
-  }
 
-  sensors_cleanup();
-  return temp;
+inline double GetSensorByName(const std::string& sensorName, bool exactMatch) {
+  LiveView::SensorQuery query =
+    LiveView::SensorQuery::by_name(sensorName, exactMatch);
+  return LiveView::SensorSession::instance().read(query);
 }
 
 inline std::vector<std::string> GetAllSensorNames() {
-  std::vector<std::string> sensorNames;
-
-  if (sensors_init(nullptr) != 0) {
-    throw std::runtime_error("Failed to initialize sensors");
-  }
+  return LiveView::SensorSession::instance().labels();
+}
 
-  const sensors_chip_name* chip;
-  int chip_nr = 0;
+#endif // __linux__
 
-  while ((chip = sensors_get_detected_chips(nullptr, &chip_nr)) != nullptr) {
-    const sensors_feature* feature;
-    int feature_nr = 0;
+#if defined(__linux__) && !defined(LIVEVIEW_CPP)
+// ===================================================================================
+// ASYNCIO SUPPORT
+// ===================================================================================
 
-    while ((feature = sensors_get_features(chip, &feature_nr)) != nullptr) {
-      const char* feature_label = sensors_get_label(chip, feature);
-      if (feature_label) {
-        sensorNames.emplace_back(feature_label);
-      }
-    }
+/**
+ * @struct AsyncRequest
+ * @brief An asyncio future waiting for a measurement on the timer thread.
+ * It holds Python references, so it always drops them with the GIL held,
+ * whichever thread releases it.
+ */
+struct AsyncRequest {
+  py::object loop;
+  py::object future;
+  py::object owner; // Keeps the collector alive until the result is set
+
+  ~AsyncRequest() {
+    py::gil_scoped_acquire gil;
+    loop = py::object();
+    future = py::object();
+    owner = py::object();
   }
+};
+
+/**
+ * @brief Sets the result (or a RuntimeError) of a future unless it was
+ * cancelled meanwhile. Runs on the event loop thread.
+ */
+inline const py::object& async_resolver() {
+  // Leaked: must not be destroyed after the interpreter is finalized
+  static py::object* resolver = new py::object(py::cpp_function(
+    [](py::object future, py::object value, bool failed) {
+      if (future.attr("done")().cast<bool>())
+        return;
+      if (failed)
+        future.attr("set_exception")(
+          py::module_::import("builtins").attr("RuntimeError")(value));
+      else
+        future.attr("set_result")(value);
+    }));
+  return *resolver;
+}
 
-  sensors_cleanup();
-  return sensorNames;
+/**
+ * @brief Stops the timer thread at interpreter exit, before Python objects
+ * held by pending requests can no longer be released.
+ */
+inline void register_async_shutdown() {
+  static bool registered = false;
+  if (registered)
+    return;
+  registered = true;
+  py::module_::import("atexit").attr("register")(py::cpp_function([]() {
+    std::vector<LiveView::TimerQueue::Task> dropped;
+    {
+      py::gil_scoped_release release; // A running task may need the GIL
+      dropped = LiveView::TimerQueue::instance().shutdown();
+    }
+  }));
 }
 
-#endif // __linux__
+/**
+ * @brief Returns an asyncio future of the running event loop that resolves
+ * to measure() once `interval_ms` has passed. measure() runs on the shared
+ * timer thread without the GIL; its result is handed to the loop with
+ * call_soon_threadsafe().
+ * @param owner Python object kept alive until then (the collector, if
+ * measure() uses it).
+ * @throws RuntimeError If there is no running event loop.
+ */
+template <typename Measure>
+py::object schedule_async(int interval_ms, py::object owner, Measure measure) {
+  if (interval_ms < 0)
+    throw std::invalid_argument("Interval must not be negative.");
+  auto request = std::make_shared<AsyncRequest>();
+  request->loop = py::module_::import("asyncio").attr("get_running_loop")();
+  request->future = request->loop.attr("create_future")();
+  request->owner = std::move(owner);
+  py::object future = request->future;
+  async_resolver();
+  register_async_shutdown();
+
+  LiveView::TimerQueue::instance().schedule_after(interval_ms,
+    [request, measure]() mutable {
+      using Result = decltype(measure());
+      Result value{};
+      std::string error;
+      try {
+        value = measure();
+      }
+      catch (const std::exception& e) {
+        error = e.what();
+        if (error.empty())
+          error = "Measurement failed.";
+      }
+      py::gil_scoped_acquire gil;
+      try {
+        py::object result;
+        if (error.empty())
+          result = py::cast(std::move(value));
+        else
+          result = py::str(error);
+        request->loop.attr("call_soon_threadsafe")(async_resolver(),
+          request->future, result, !error.empty());
+      }
+      catch (py::error_already_set&) {
+        // The event loop was closed: nobody is waiting any more
+      }
+    });
+  return future;
+}
+#endif
 // ===================================================================================
 // MONITORING CLASSES
 // ===================================================================================
@@ -428,6 +753,23 @@ inline std::vector<std::string> GetAllSensorNames() {
  * @brief Provides CPU monitoring functionalities.
  */
 class PyLiveCPU {
+private:
+  // Previous snapshot kept for the non-blocking delta mode
+#ifdef _WIN32
+  std::vector<SYSTEM_PROCESSOR_PERFORMANCE_INFORMATION> prevData;
+  std::vector<SYSTEM_PROCESSOR_PERFORMANCE_INFORMATION> currData;
+#elif __linux__
+  CpuTimes prevTimes{};
+  // Per-core state, reused across calls to stay allocation-free
+  std::string statBuffer;
+  std::vector<CpuTimes> prevCores;
+  std::vector<CpuTimes> currCores;
+  std::vector<double> coreUsage;
+  bool hasPrevCores = false;
+#endif
+  std::chrono::steady_clock::time_point prevTime;
+  bool hasPrev = false;
+
 public:
   /**
    * @brief Gets the overall CPU usage percentage over a specified interval.
@@ -443,22 +785,101 @@ public:
     std::this_thread::sleep_for(std::chrono::milliseconds(interval_ms));
     CpuTimes end = get_cpu_times();
 
-    long long idle_delta = get_idle_time(end) - get_idle_time(start);
-    long long total_delta = get_total_time(end) - get_total_time(start);
+    return calc_cpu_usage(start, end);
+#else
+    throw std::runtime_error("Unsupported platform for CPU usage.");
+#endif
+  }
+
+  /**
+   * @brief Gets the CPU usage since the previous call without sleeping.
+   * The first call only stores a snapshot and returns {0.0, 0.0}.
+   * @return A pair of {CPU usage (0-100), elapsed milliseconds}.
+   */
+  std::pair<double, double> get_usage_delta() {
+    auto now = std::chrono::steady_clock::now();
+    double usage = 0.0;
+#ifdef _WIN32
+    LiveView::CollectorTimer timer(LiveView::COLLECTOR_CPU);
+    SYSTEM_INFO sysInfo;
+    GetSystemInfo(&sysInfo);
+    DWORD numCores = sysInfo.dwNumberOfProcessors;
+    currData.resize(numCores);
+    ULONG len = sizeof(SYSTEM_PROCESSOR_PERFORMANCE_INFORMATION) * numCores;
+
+    if (!NT_SUCCESS(NtQuerySystemInformation(
+      SystemProcessorPerformanceInformation, currData.data(), len, NULL))) {
+      throw std::runtime_error("Failed to query system information.");
+    }
 
-    if (total_delta == 0)
-      return 0.0;
-    return (1.0 - static_cast<double>(idle_delta) / total_delta) * 100.0;
+    if (hasPrev && prevData.size() == numCores) {
+      for (DWORD i = 0; i < numCores; ++i) {
+        usage += CalculateCpuUsagePerCore(prevData[i], currData[i]);
+      }
+      usage /= numCores;
+    }
+    prevData.swap(currData);
+#elif __linux__
+    CpuTimes curr = get_cpu_times();
+    if (hasPrev)
+      usage = calc_cpu_usage(prevTimes, curr);
+    prevTimes = curr;
 #else
     throw std::runtime_error("Unsupported platform for CPU usage.");
 #endif
+    double elapsed_ms =
+      hasPrev ? std::chrono::duration<double, std::milli>(now - prevTime).count()
+              : 0.0;
+    prevTime = now;
+    hasPrev = true;
+    return { usage, elapsed_ms };
+  }
+
+#ifdef __linux__
+  /**
+   * @brief (Linux-only) Gets the utilisation of every core since the previous
+   * call without sleeping. The first call returns zeros.
+   * @return A flat vector with CPU_CORE_FIELDS values per core, core-major:
+   * user, system, iowait, irq, softirq and steal percentages.
+   */
+  const std::vector<double>& get_per_core_usage() {
+    get_per_core_cpu_times(statBuffer, currCores);
+    if (hasPrevCores)
+      calc_per_core_usage(prevCores, currCores, coreUsage);
+    else
+      coreUsage.assign(currCores.size() * CPU_CORE_FIELDS, 0.0);
+    prevCores.swap(currCores);
+    hasPrevCores = true;
+    return coreUsage;
+  }
+
+  /**
+   * @brief (Linux-only) The /proc/stat times read by the last
+   * get_usage_delta() call.
+   */
+  const CpuTimes& last_times() const { return prevTimes; }
+#endif
+#if defined(__linux__) && !defined(LIVEVIEW_CPP)
+  /**
+   * @brief (Linux only) Awaitable get_usage(): takes the first snapshot now
+   * and the second one on the shared timer thread, so the caller never
+   * blocks.
+   * @return An asyncio future of the CPU usage percentage.
+   */
+  py::object get_usage_async(int interval_ms) const {
+    CpuTimes start = get_cpu_times();
+    return schedule_async(interval_ms, py::none(), [start]() {
+      return calc_cpu_usage(start, get_cpu_times());
+    });
   }
+#endif
 
   /**
    * @brief Retrieves detailed CPU information using the CPUID instruction.
    * @return A vector pair of strings containing CPU details.
    */
   inline std::vector<std::pair<std::string, std::string>> cpuid() {
+    LiveView::CollectorTimer timer(LiveView::COLLECTOR_CPUID);
     auto res = cpuid::helpers::Smart_cpuid();
     std::vector<std::pair<std::string, std::string>> result;
     for (auto& r : res) {
@@ -521,6 +942,100 @@ public:
 #endif
 };
 
+#ifdef __linux__
+/**
+ * @class PyLiveCPUFreq
+ * @brief (Linux only) Per-core clock speed: the cpufreq frequency of every
+ * online core in one sweep, plus the effective frequency from the
+ * APERF/MPERF counters where /dev/cpu/N/msr is readable.
+ */
+class PyLiveCPUFreq {
+private:
+  LiveView::CpuFreqReader reader;
+  double baseMHz = 0; // CPUID leaf 0x16, 0 if not reported
+  double maxMHz = 0;
+  double busMHz = 0;
+  std::chrono::steady_clock::time_point prevTime;
+  bool hasPrev = false;
+
+  /**
+   * @brief Reads the processor frequency leaf (Intel; 0 elsewhere).
+   */
+  static double cpuid_leaf16(int reg) {
+    if (!cpuid::is_leaf_supported(0x16))
+      return 0;
+    int regs[4];
+    cpuid::do_cpuid(regs, 0x16);
+    return regs[reg] > 0 ? static_cast<double>(regs[reg] & 0xFFFF) : 0;
+  }
+
+  std::vector<LiveView::CoreFrequency> sweep() {
+    LiveView::CollectorTimer timer(LiveView::COLLECTOR_CPU_FREQ);
+    std::vector<LiveView::CoreFrequency> cores;
+    reader.read(cores);
+    return cores;
+  }
+
+public:
+  PyLiveCPUFreq()
+    : reader(cpuid_leaf16(0)), baseMHz(cpuid_leaf16(0)),
+    maxMHz(cpuid_leaf16(1)), busMHz(cpuid_leaf16(2)) {}
+
+  /**
+   * @brief Gets the frequency of every online core. effective_MHz covers
+   * the interval.
+   * @param interval The interval in milliseconds between the two sweeps.
+   */
+  std::vector<LiveView::CoreFrequency> get_frequencies(int interval = 1000) {
+    sweep();
+    {
+      HV_GIL_RELEASE;
+      std::this_thread::sleep_for(std::chrono::milliseconds(interval));
+    }
+    return sweep();
+  }
+
+  /**
+   * @brief Gets the frequency of every online core without sleeping;
+   * effective_MHz covers the time since the previous call (-1 on the first
+   * one).
+   * @return A pair of {per-core frequencies, elapsed milliseconds}.
+   */
+  std::pair<std::vector<LiveView::CoreFrequency>, double>
+    get_frequencies_delta() {
+    auto now = std::chrono::steady_clock::now();
+    double elapsed_ms = hasPrev
+      ? std::chrono::duration<double, std::milli>(now - prevTime).count()
+      : 0.0;
+    auto cores = sweep();
+    prevTime = now;
+    hasPrev = true;
+    return { cores, elapsed_ms };
+  }
+
+  /**
+   * @brief Base (nominal) frequency in MHz from CPUID leaf 0x16, 0 if the
+   * processor does not report it.
+   */
+  double get_base_frequency() const { return baseMHz; }
+
+  /**
+   * @brief Maximum (turbo) frequency in MHz from CPUID leaf 0x16, or 0.
+   */
+  double get_max_frequency() const { return maxMHz; }
+
+  /**
+   * @brief Bus (reference) frequency in MHz from CPUID leaf 0x16, or 0.
+   */
+  double get_bus_frequency() const { return busMHz; }
+
+  /**
+   * @brief True if the last sweep could read the APERF/MPERF counters.
+   */
+  bool has_effective_frequency() { return reader.msr_available(); }
+};
+#endif
+
 /**
  * @class PyLiveRam
  * @brief Provides RAM monitoring functionalities.
@@ -534,6 +1049,7 @@ public:
    * @return RAM usage as a percentage or a vector of raw values.
    */
   std::variant<double, std::vector<double>> get_usage(bool Raw = false) const {
+    LiveView::CollectorTimer timer(LiveView::COLLECTOR_RAM);
 #ifdef _WIN32
     MEMORYSTATUSEX memInfo = { sizeof(memInfo) };
     if (!GlobalMemoryStatusEx(&memInfo)) {
@@ -548,23 +1064,11 @@ public:
     }
     return (static_cast<double>(usedPhys) / totalPhys) * 100.0;
 #elif __linux__
-    std::ifstream meminfo_file("/proc/meminfo");
-    if (!meminfo_file.is_open())
+    static thread_local std::string buffer; // Reused between calls
+    if (!LiveView::read_proc_file("/proc/meminfo", buffer))
       throw std::runtime_error("Failed to open /proc/meminfo.");
-    std::string line;
-    long long memTotal = -1, memAvailable = -1;
-    while (std::getline(meminfo_file, line)) {
-      if (line.rfind("MemTotal:", 0) == 0) {
-        std::stringstream ss(line);
-        std::string key;
-        ss >> key >> memTotal;
-      }
-      else if (line.rfind("MemAvailable:", 0) == 0) {
-        std::stringstream ss(line);
-        std::string key;
-        ss >> key >> memAvailable;
-      }
-    }
+    long long memTotal = LiveView::find_key_ll(buffer, "MemTotal:");
+    long long memAvailable = LiveView::find_key_ll(buffer, "MemAvailable:");
     if (memTotal == -1 || memAvailable == -1) {
       throw std::runtime_error(
         "Failed to parse MemTotal or MemAvailable from /proc/meminfo.");
@@ -592,32 +1096,79 @@ private:
   PDH_HCOUNTER counter = nullptr;
   PDH_HCOUNTER readCounter = nullptr;
   PDH_HCOUNTER writeCounter = nullptr;
+#elif __linux__
+  std::string statBuffer;                    // Reused /proc/diskstats buffer
+  LiveView::DeviceTable<DiskStats> deltaStats;  // Counters for delta mode
+  LiveView::DeviceTable<DiskStats> deviceStats; // get_device_stats_delta()
+  std::chrono::steady_clock::time_point devicePrevTime;
+  bool hasPrevDevice = false;
 #endif
   int mode = 0;
+  std::chrono::steady_clock::time_point prevTime;
+  bool hasPrev = false;
 
-public:
+#ifdef _WIN32
   /**
-   * @brief Constructs a PyLiveDisk monitor.
-   * @param mode 0 for '% Disk Time' (Windows-only), 1 for R/W speed in MB/s.
+   * @brief Reads the formatted counter values of the last collected sample.
    */
-  PyLiveDisk(int mode) : mode(mode) {
-#ifdef _WIN32
-    if (PdhOpenQuery(NULL, 0, &query) != ERROR_SUCCESS)
-      throw std::runtime_error("Disk Monitor: Failed to open PDH query.");
-
+  std::variant<double, std::vector<std::pair<std::string, double>>>
+    read_counters() {
     if (mode == 0) {
-      if (PdhAddCounterW(query, L"\\PhysicalDisk(_Total)\\% Disk Time", 0,
-        &counter) != ERROR_SUCCESS)
-        throw std::runtime_error(
-          "Disk Monitor: Failed to add '% Disk Time' counter.");
+      PDH_FMT_COUNTERVALUE value;
+      if (PdhGetFormattedCounterValue(counter, PDH_FMT_DOUBLE, NULL, &value) !=
+        ERROR_SUCCESS)
+        throw std::runtime_error("Disk Monitor: Failed to read '% Disk Time'.");
+      if (value.CStatus != ERROR_SUCCESS) {
+        return -0.1;
+      }
+      return value.doubleValue;
     }
-    else if (mode == 1) {
-      if (PdhAddCounterW(query, L"\\PhysicalDisk(_Total)\\Disk Read Bytes/sec",
-        0, &readCounter) != ERROR_SUCCESS)
+    else { // mode == 1
+      PDH_FMT_COUNTERVALUE valueRead, valueWrite;
+      if (PdhGetFormattedCounterValue(readCounter, PDH_FMT_DOUBLE, NULL,
+        &valueRead) != ERROR_SUCCESS)
         throw std::runtime_error(
-          "Disk Monitor: Failed to add 'Disk Read Bytes/sec' counter.");
-      if (PdhAddCounterW(query, L"\\PhysicalDisk(_Total)\\Disk Write Bytes/sec",
-        0, &writeCounter) != ERROR_SUCCESS)
+          "Disk Monitor: Failed to read 'Disk Read Bytes/sec'.");
+      if (PdhGetFormattedCounterValue(writeCounter, PDH_FMT_DOUBLE, NULL,
+        &valueWrite) != ERROR_SUCCESS)
+        throw std::runtime_error(
+          "Disk Monitor: Failed to read 'Disk Write Bytes/sec'.");
+      if (valueRead.CStatus != ERROR_SUCCESS ||
+        valueWrite.CStatus != ERROR_SUCCESS) {
+        return std::vector<std::pair<std::string, double>>{
+          {"Read MB/s", -0.1}, { "Write MB/s", -0.1 }};
+      }
+      double read_MBps = valueRead.doubleValue / (1024.0 * 1024.0);
+      double write_MBps = valueWrite.doubleValue / (1024.0 * 1024.0);
+      return std::vector<std::pair<std::string, double>>{
+        {"Read MB/s", read_MBps}, { "Write MB/s", write_MBps }};
+    }
+  }
+#endif
+
+public:
+  /**
+   * @brief Constructs a PyLiveDisk monitor.
+   * @param mode 0 for '% Disk Time' (Windows-only), 1 for R/W speed in MB/s.
+   */
+  PyLiveDisk(int mode) : mode(mode) {
+#ifdef _WIN32
+    if (PdhOpenQuery(NULL, 0, &query) != ERROR_SUCCESS)
+      throw std::runtime_error("Disk Monitor: Failed to open PDH query.");
+
+    if (mode == 0) {
+      if (PdhAddCounterW(query, L"\\PhysicalDisk(_Total)\\% Disk Time", 0,
+        &counter) != ERROR_SUCCESS)
+        throw std::runtime_error(
+          "Disk Monitor: Failed to add '% Disk Time' counter.");
+    }
+    else if (mode == 1) {
+      if (PdhAddCounterW(query, L"\\PhysicalDisk(_Total)\\Disk Read Bytes/sec",
+        0, &readCounter) != ERROR_SUCCESS)
+        throw std::runtime_error(
+          "Disk Monitor: Failed to add 'Disk Read Bytes/sec' counter.");
+      if (PdhAddCounterW(query, L"\\PhysicalDisk(_Total)\\Disk Write Bytes/sec",
+        0, &writeCounter) != ERROR_SUCCESS)
         throw std::runtime_error(
           "Disk Monitor: Failed to add 'Disk Write Bytes/sec' counter.");
     }
@@ -626,6 +1177,8 @@ public:
         "percentage or 1 for read/write speed.");
     }
     PdhCollectQueryData(query); // Initial sample
+    prevTime = std::chrono::steady_clock::now();
+    hasPrev = true;
 #elif __linux__
     if (mode == 0)
       throw std::runtime_error("Mode 0 (% usage) is not supported on Linux. "
@@ -636,234 +1189,1525 @@ public:
 #endif
   }
 
-  ~PyLiveDisk() {
-#ifdef _WIN32
-    if (query)
-      PdhCloseQuery(query);
-#endif
+  ~PyLiveDisk() {
+#ifdef _WIN32
+    if (query)
+      PdhCloseQuery(query);
+#endif
+  }
+
+  /**
+   * @brief Gets the disk usage based on the mode set in the constructor.
+   * @param interval The interval in milliseconds between measurements.
+   * @return A double for percentage usage or a vector of {read_MBps,
+   * write_MBps}.
+   */
+  std::variant<double, std::vector<std::pair<std::string, double>>>
+    get_usage(int interval = 1000) {
+#ifdef _WIN32
+    HV_GIL_RELEASE;
+    Sleep(interval);
+    if (PdhCollectQueryData(query) != ERROR_SUCCESS)
+      throw std::runtime_error("Disk Monitor: Failed to collect query data.");
+    prevTime = std::chrono::steady_clock::now();
+
+    return read_counters();
+#elif __linux__
+    // Per-thread so concurrent calls (the GIL is released while sleeping) do
+    // not share state; still allocation-free after the first call.
+    static thread_local std::string buffer;
+    static thread_local LiveView::DeviceTable<DiskStats> stats;
+    get_disk_stats(buffer, stats);
+    HV_GIL_RELEASE;
+    std::this_thread::sleep_for(std::chrono::milliseconds(interval));
+    get_disk_stats(buffer, stats);
+
+    return calc_disk_rates(stats, static_cast<double>(interval) / 1000.0);
+#endif
+  }
+
+  /**
+   * @brief Gets the disk usage since the previous call without sleeping.
+   * On Linux the first call only stores a snapshot and returns zero speeds.
+   * @return A pair of {usage as returned by get_usage(), elapsed milliseconds}.
+   */
+  std::pair<std::variant<double, std::vector<std::pair<std::string, double>>>,
+    double>
+    get_usage_delta() {
+    auto now = std::chrono::steady_clock::now();
+    double elapsed_ms =
+      hasPrev ? std::chrono::duration<double, std::milli>(now - prevTime).count()
+              : 0.0;
+#ifdef _WIN32
+    if (PdhCollectQueryData(query) != ERROR_SUCCESS)
+      throw std::runtime_error("Disk Monitor: Failed to collect query data.");
+    prevTime = now;
+    return { read_counters(), elapsed_ms };
+#elif __linux__
+    get_disk_stats(statBuffer, deltaStats);
+    auto rates = calc_disk_rates(deltaStats, elapsed_ms / 1000.0);
+    prevTime = now;
+    hasPrev = true;
+    return { rates, elapsed_ms };
+#endif
+  }
+
+#ifdef __linux__
+  /**
+   * @brief (Linux only) The /proc/diskstats counters read by the last
+   * get_usage_delta() call.
+   */
+  const LiveView::DeviceTable<DiskStats>& last_stats() const {
+    return deltaStats;
+  }
+#ifndef LIVEVIEW_CPP
+  /**
+   * @brief (Linux only) Awaitable get_usage(): the second snapshot is taken
+   * on the shared timer thread. Rates cover the measured time between the
+   * two snapshots.
+   * @return An asyncio future of [("Read MB/s", x), ("Write MB/s", y)].
+   */
+  py::object get_usage_async(int interval = 1000) const {
+    std::string buffer;
+    LiveView::DeviceTable<DiskStats> stats;
+    get_disk_stats(buffer, stats);
+    auto start = std::chrono::steady_clock::now();
+    return schedule_async(interval, py::none(),
+      [buffer, stats, start]() mutable {
+        get_disk_stats(buffer, stats);
+        return calc_disk_rates(stats, std::chrono::duration<double>(
+          std::chrono::steady_clock::now() - start).count());
+      });
+  }
+#endif
+
+  /**
+   * @brief (Linux only) Gets per-device metrics for every whole disk:
+   * IOPS, merged operations, throughput, await, queue size and % busy.
+   * @param interval The interval in milliseconds between measurements.
+   */
+  std::vector<DiskDeviceStats> get_device_stats(int interval = 1000) {
+    // Per-thread so concurrent calls (the GIL is released while sleeping) do
+    // not share state.
+    static thread_local std::string buffer;
+    static thread_local LiveView::DeviceTable<DiskStats> stats;
+    get_disk_stats(buffer, stats);
+    HV_GIL_RELEASE;
+    std::this_thread::sleep_for(std::chrono::milliseconds(interval));
+    get_disk_stats(buffer, stats);
+
+    return calc_disk_device_stats(stats, static_cast<double>(interval) / 1000.0);
+  }
+
+  /**
+   * @brief (Linux only) Gets per-device metrics since the previous call
+   * without sleeping. The first call only stores a snapshot.
+   * @return A pair of {per-device metrics, elapsed milliseconds}.
+   */
+  std::pair<std::vector<DiskDeviceStats>, double> get_device_stats_delta() {
+    auto now = std::chrono::steady_clock::now();
+    double elapsed_ms = hasPrevDevice
+      ? std::chrono::duration<double, std::milli>(now - devicePrevTime).count()
+      : 0.0;
+    get_disk_stats(statBuffer, deviceStats);
+    auto devices = calc_disk_device_stats(deviceStats, elapsed_ms / 1000.0);
+    devicePrevTime = now;
+    hasPrevDevice = true;
+    return { devices, elapsed_ms };
+  }
+#endif
+
+  /**
+   * @brief (Mode 1 only) Checks if disk R/W speed exceeds a threshold.
+   * @param threshold_mbps The threshold in MB/s.
+   * @return True if usage is high, false otherwise.
+   */
+  bool HighDiskUsage(double threshold_mbps = 80.0) {
+    if (mode != 1) {
+      throw std::runtime_error("HighDiskUsage() can only be called in mode 1.");
+    }
+    auto usage =
+      std::get<std::vector<std::pair<std::string, double>>>(get_usage(1000));
+    return usage[0].second > threshold_mbps || usage[1].second > threshold_mbps;
+  }
+};
+
+/**
+ * @class PyLiveNetwork
+ * @brief Provides network I/O monitoring functionalities.
+ */
+class PyLiveNetwork {
+private:
+#ifdef _WIN32
+  PDH_HQUERY query = nullptr;
+  PDH_HCOUNTER counter = nullptr;
+#elif __linux__
+  LiveView::NetworkStatsReader reader;  // Netlink or /proc/net/dev
+  std::mutex readerMutex;               // reader is not thread-safe
+  LiveView::DeviceTable<NetworkStats> deltaStats;     // Delta mode counters
+  LiveView::DeviceTable<NetworkStats> interfaceStats; // Per-interface delta
+  std::chrono::steady_clock::time_point interfacePrevTime;
+  bool hasPrevInterface = false;
+
+  void read_stats(LiveView::DeviceTable<NetworkStats>& table) {
+    std::lock_guard<std::mutex> lock(readerMutex);
+    reader.read(table);
+  }
+#endif
+  std::chrono::steady_clock::time_point prevTime;
+  bool hasPrev = false;
+
+#ifdef _WIN32
+  /**
+   * @brief Reads the formatted counter array of the last collected sample.
+   * @param mode 0 for total speed (MB/s), 1 for per-interface speed (MB/s).
+   */
+  std::variant<double, std::vector<std::pair<std::string, double>>>
+    read_counters(int mode) {
+    DWORD bufferSize = 0, itemCount = 0;
+    PDH_FMT_COUNTERVALUE_ITEM_W* items = nullptr;
+    auto status = PdhGetFormattedCounterArrayW(
+      counter, PDH_FMT_DOUBLE, &bufferSize, &itemCount, nullptr);
+    if (status != PDH_MORE_DATA)
+      throw std::runtime_error("Network Monitor: Failed to get buffer size for "
+        "counter array. PDH Error: " +
+        std::to_string(status));
+
+    std::vector<BYTE> buffer(bufferSize);
+    items = reinterpret_cast<PDH_FMT_COUNTERVALUE_ITEM_W*>(buffer.data());
+
+    if (PdhGetFormattedCounterArrayW(counter, PDH_FMT_DOUBLE, &bufferSize,
+      &itemCount, items) != ERROR_SUCCESS) {
+      throw std::runtime_error(
+        "Network Monitor: Failed to get formatted counter array.");
+    }
+
+    if (mode == 0) {
+      double totalBytes = 0;
+      for (DWORD i = 0; i < itemCount; ++i) {
+        if (items[i].FmtValue.CStatus != ERROR_SUCCESS)
+          continue;
+        totalBytes += items[i].FmtValue.doubleValue;
+      }
+      return totalBytes / (1024.0 * 1024.0); // Return total MB/s
+    }
+    else {                                 // mode == 1
+      std::vector<std::pair<std::string, double>> result;
+      for (DWORD i = 0; i < itemCount; ++i) {
+        if (items[i].FmtValue.CStatus != ERROR_SUCCESS) {
+          items[i].FmtValue.doubleValue = -0.1;
+        }
+        result.emplace_back(wstring_to_utf8(items[i].szName),
+          items[i].FmtValue.doubleValue / (1024.0 * 1024.0));
+      }
+      return result;
+    }
+  }
+#endif
+
+public:
+  /**
+   * @brief Constructs a PyLiveNetwork monitor.
+   * @param backend (Linux only) NET_BACKEND_AUTO (netlink with /proc/net/dev
+   * as fallback), NET_BACKEND_NETLINK or NET_BACKEND_PROCFS. Ignored on
+   * Windows.
+   */
+#ifdef __linux__
+  PyLiveNetwork(int backend = LiveView::NET_BACKEND_AUTO) : reader(backend) {
+#else
+  PyLiveNetwork(int backend = 0) {
+    (void)backend;
+#endif
+#ifdef _WIN32
+    if (PdhOpenQuery(NULL, 0, &query) != ERROR_SUCCESS)
+      throw std::runtime_error("Network Monitor: Failed to open PDH query.");
+    // Use the English counter name to be locale-independent
+    if (PdhAddEnglishCounterW(query, L"\\Network Interface(*)\\Bytes Total/sec",
+      0, &counter) != ERROR_SUCCESS)
+      throw std::runtime_error(
+        "Network Monitor: Failed to add 'Bytes Total/sec' counter.");
+    PdhCollectQueryData(query);
+    prevTime = std::chrono::steady_clock::now();
+    hasPrev = true;
+#endif
+  }
+
+  ~PyLiveNetwork() {
+#ifdef _WIN32
+    if (query)
+      PdhCloseQuery(query);
+#endif
+  }
+
+  /**
+   * @brief Gets network usage.
+   * @param interval The interval in milliseconds.
+   * @param mode 0 for total speed (MB/s), 1 for per-interface speed (MB/s).
+   * @return Total speed as a double or per-interface speeds as a vector of
+   * pairs.
+   */
+  std::variant<double, std::vector<std::pair<std::string, double>>>
+    get_usage(int interval = 1000, int mode = 0) {
+#ifdef _WIN32
+    HV_GIL_RELEASE;
+    Sleep(interval);
+    if (PdhCollectQueryData(query) != ERROR_SUCCESS)
+      throw std::runtime_error(
+        "Network Monitor: Failed to collect query data.");
+    prevTime = std::chrono::steady_clock::now();
+
+    return read_counters(mode);
+#elif __linux__
+    // Per-thread so concurrent calls (the GIL is released while sleeping) do
+    // not share state; still allocation-free after the first call.
+    static thread_local LiveView::DeviceTable<NetworkStats> stats;
+    read_stats(stats);
+    HV_GIL_RELEASE;
+    std::this_thread::sleep_for(std::chrono::milliseconds(interval));
+    read_stats(stats);
+
+    return calc_network_usage(stats, static_cast<double>(interval) / 1000.0,
+      mode);
+#endif
+  }
+
+  /**
+   * @brief Gets network usage since the previous call without sleeping.
+   * On Linux the first call only stores a snapshot and returns zero speeds.
+   * @param mode 0 for total speed (MB/s), 1 for per-interface speed (MB/s).
+   * @return A pair of {usage as returned by get_usage(), elapsed milliseconds}.
+   */
+  std::pair<std::variant<double, std::vector<std::pair<std::string, double>>>,
+    double>
+    get_usage_delta(int mode = 0) {
+    auto now = std::chrono::steady_clock::now();
+    double elapsed_ms =
+      hasPrev ? std::chrono::duration<double, std::milli>(now - prevTime).count()
+              : 0.0;
+#ifdef _WIN32
+    if (PdhCollectQueryData(query) != ERROR_SUCCESS)
+      throw std::runtime_error(
+        "Network Monitor: Failed to collect query data.");
+    prevTime = now;
+    return { read_counters(mode), elapsed_ms };
+#elif __linux__
+    read_stats(deltaStats);
+    auto usage = calc_network_usage(deltaStats, elapsed_ms / 1000.0, mode);
+    prevTime = now;
+    hasPrev = true;
+    return { usage, elapsed_ms };
+#endif
+  }
+
+#ifdef __linux__
+  /**
+   * @brief (Linux only) Gets rx/tx bytes, packets, errors and drops per
+   * second for every interface except loopback.
+   * @param interval The interval in milliseconds between measurements.
+   */
+  std::vector<NetInterfaceStats> get_interface_stats(int interval = 1000) {
+    static thread_local LiveView::DeviceTable<NetworkStats> stats;
+    read_stats(stats);
+    HV_GIL_RELEASE;
+    std::this_thread::sleep_for(std::chrono::milliseconds(interval));
+    read_stats(stats);
+
+    return calc_interface_stats(stats, static_cast<double>(interval) / 1000.0);
+  }
+
+  /**
+   * @brief (Linux only) Gets per-interface rates since the previous call
+   * without sleeping. The first call only stores a snapshot.
+   * @return A pair of {per-interface rates, elapsed milliseconds}.
+   */
+  std::pair<std::vector<NetInterfaceStats>, double> get_interface_stats_delta() {
+    auto now = std::chrono::steady_clock::now();
+    double elapsed_ms = hasPrevInterface
+      ? std::chrono::duration<double, std::milli>(now - interfacePrevTime)
+      .count()
+      : 0.0;
+    read_stats(interfaceStats);
+    auto interfaces = calc_interface_stats(interfaceStats, elapsed_ms / 1000.0);
+    interfacePrevTime = now;
+    hasPrevInterface = true;
+    return { interfaces, elapsed_ms };
+  }
+
+  /**
+   * @brief (Linux only) The backend in use: "netlink" or "procfs".
+   */
+  std::string get_backend() {
+    std::lock_guard<std::mutex> lock(readerMutex);
+    return reader.backend();
+  }
+
+  /**
+   * @brief (Linux only) The counters read by the last get_usage_delta()
+   * call.
+   */
+  const LiveView::DeviceTable<NetworkStats>& last_stats() const {
+    return deltaStats;
+  }
+#ifndef LIVEVIEW_CPP
+  /**
+   * @brief (Linux only) Awaitable get_usage(): the second snapshot is taken
+   * on the shared timer thread. Rates cover the measured time between the
+   * two snapshots.
+   * @param mode 0 for total speed (MB/s), 1 for per-interface speed (MB/s).
+   * @return An asyncio future of the usage, as returned by get_usage().
+   */
+  py::object get_usage_async(int interval = 1000, int mode = 0) {
+    LiveView::DeviceTable<NetworkStats> stats;
+    read_stats(stats);
+    auto start = std::chrono::steady_clock::now();
+    // The timer thread uses this monitor's reader: keep it alive until then
+    return schedule_async(interval,
+      py::cast(this, py::return_value_policy::reference),
+      [this, stats, start, mode]() mutable {
+        read_stats(stats);
+        return calc_network_usage(stats, std::chrono::duration<double>(
+          std::chrono::steady_clock::now() - start).count(), mode);
+      });
+  }
+#endif
+#endif
+
+  /**
+   * @brief Gets the name of the network interface with the highest usage.
+   * @return The name of the adapter as a string.
+   */
+  std::string getHighCard() {
+    auto cards = std::get<std::vector<std::pair<std::string, double>>>(
+      get_usage(1000, 1));
+    if (cards.empty())
+      return "N/A";
+
+    auto max_it = std::max_element(
+      cards.begin(), cards.end(),
+      [](const auto& a, const auto& b) { return a.second < b.second; });
+    return max_it->first;
+  }
+};
+
+#ifdef __linux__
+/**
+ * @class PyLivePressure
+ * @brief (Linux only) Pressure stall information: how long tasks waited for
+ * CPU, memory and I/O, system-wide or for one cgroup v2 group. PSI triggers
+ * let a monitor sleep until stall time crosses a threshold instead of
+ * polling.
+ */
+class PyLivePressure {
+private:
+  LiveView::PressureMonitor monitor;
+
+public:
+  /**
+   * @param cgroup "" for the whole system, else a cgroup v2 directory
+   * (absolute, or relative to /sys/fs/cgroup).
+   */
+  explicit PyLivePressure(const std::string& cgroup = "") : monitor(cgroup) {}
+
+  /**
+   * @brief Reads the pressure of one resource.
+   * @param resource "cpu", "memory", "io" or "irq".
+   */
+  LiveView::PressureStats get_pressure(const std::string& resource) const {
+    LiveView::CollectorTimer timer(LiveView::COLLECTOR_PRESSURE);
+    return monitor.read(resource);
+  }
+
+  /**
+   * @brief Reads the pressure of every available resource.
+   */
+  std::vector<LiveView::PressureStats> get_all() const {
+    LiveView::CollectorTimer timer(LiveView::COLLECTOR_PRESSURE);
+    return monitor.read_all();
+  }
+
+  /**
+   * @brief Registers a PSI trigger that fires when tasks stall for
+   * `stall_us` within any `window_us` window.
+   * @param kind "some" (at least one task stalled) or "full" (all non-idle
+   * tasks stalled).
+   * @return The trigger id, as returned by wait().
+   */
+  int add_trigger(const std::string& resource, uint64_t stall_us,
+    uint64_t window_us = 2000000, const std::string& kind = "some") {
+    if (kind != "some" && kind != "full")
+      throw std::invalid_argument("Trigger kind must be 'some' or 'full'.");
+    HV_GIL_RELEASE; // Opens and writes the pressure file
+    return monitor.add_trigger(resource, kind == "full", stall_us, window_us);
+  }
+
+  bool remove_trigger(int id) {
+    HV_GIL_RELEASE;
+    return monitor.remove_trigger(id);
+  }
+
+  size_t trigger_count() {
+    HV_GIL_RELEASE;
+    return monitor.trigger_count();
+  }
+
+  /**
+   * @brief Sleeps (without the GIL) until at least one trigger fires.
+   * @param timeout_ms Maximum time to wait; -1 waits forever.
+   * @return The ids of the triggers that fired; empty on timeout or
+   * interrupt().
+   */
+  std::vector<int> wait(int timeout_ms = -1) {
+    std::vector<int> fired;
+    {
+      HV_GIL_RELEASE;
+      fired = monitor.wait(timeout_ms);
+    }
+#ifndef LIVEVIEW_CPP
+    // poll() returns early on a signal: raise KeyboardInterrupt & co. now
+    if (PyErr_CheckSignals() != 0)
+      throw py::error_already_set();
+#endif
+    return fired;
+  }
+
+  /**
+   * @brief Makes a running (or the next) wait() return an empty list.
+   * Thread-safe.
+   */
+  void interrupt() { monitor.interrupt(); }
+
+  std::string get_cgroup() const { return monitor.get_cgroup(); }
+};
+#endif
+
+/**
+ * @struct LiveSample
+ * @brief One timestamped set of system metrics collected by PySamplerService.
+ */
+struct LiveSample {
+  int64_t timestamp_ns = 0; // Monotonic (steady_clock) timestamp
+  int64_t wall_time_ns = 0; // Wall-clock (system_clock) timestamp
+  double interval_ms = 0;   // Time covered by the rates below
+  double cpu_usage = 0;     // CPU usage percentage
+  double ram_usage = 0;     // RAM usage percentage
+  double ram_used_bytes = 0;
+  double ram_total_bytes = 0;
+  double disk_read_MBps = 0;
+  double disk_write_MBps = 0;
+  double net_MBps = 0;      // Total network traffic (received + transmitted)
+};
+
+/**
+ * @class PySamplerService
+ * @brief Collects CPU, RAM, disk and network metrics on one background native
+ * thread at a fixed cadence and keeps them in a lock-free ring buffer.
+ * Readers never block the collector and collection never takes the GIL.
+ */
+class PySamplerService {
+private:
+  PyLiveCPU cpu;
+  PyLiveRam ram;
+  PyLiveDisk disk{ 1 };
+  PyLiveNetwork net;
+  LiveView::SampleRing<LiveSample> ring;
+
+  std::thread worker;
+  std::atomic<bool> running{ false };
+  std::atomic<int> interval_ms;
+  std::atomic<uint64_t> errors{ 0 };
+  std::mutex waitMutex;
+  std::condition_variable waitCv;
+  std::vector<double> row; // Per-core/per-device values of the last collect()
+#ifdef __linux__
+  // Per-core and per-device history columns, laid out by the first start():
+  // the busy % of every core, the read and write MB/s of every physical
+  // disk, then the received and transmitted MB/s of every interface.
+  // Devices that appear later are not tracked; missing ones read 0.
+  bool hasLayout = false;
+  size_t layoutCores = 0;
+  std::vector<std::string> layoutDisks;
+  std::vector<std::string> layoutInterfaces;
+  // Table index of every layout disk and interface (NO_SLOT when missing),
+  // resolved again only when the table membership changes
+  static constexpr size_t NO_SLOT = static_cast<size_t>(-1);
+  std::vector<size_t> diskSlots;
+  std::vector<size_t> netSlots;
+  uint64_t diskMembership = 0;
+  uint64_t netMembership = 0;
+  std::string coreBuffer;
+  std::vector<CpuTimes> prevCores;
+  std::vector<CpuTimes> currCores;
+
+  /**
+   * @brief Fixes the history columns from the devices seen by the priming
+   * collect().
+   */
+  void make_layout() {
+    layoutCores = prevCores.size();
+    const auto& disks = disk.last_stats();
+    for (size_t i = 0; i < disks.size(); ++i) {
+      if (disks[i].present && disks[i].value.physical)
+        layoutDisks.emplace_back(disks[i].name);
+    }
+    const auto& nets = net.last_stats();
+    for (size_t i = 0; i < nets.size(); ++i) {
+      if (nets[i].present)
+        layoutInterfaces.emplace_back(nets[i].name);
+    }
+    ring.set_width(layoutCores + 2 * layoutDisks.size() +
+      2 * layoutInterfaces.size());
+    row.assign(ring.row_width(), 0.0);
+    resolve_slots(disks, layoutDisks, diskSlots);
+    diskMembership = disks.membership();
+    resolve_slots(nets, layoutInterfaces, netSlots);
+    netMembership = nets.membership();
+    hasLayout = true;
+  }
+
+  /**
+   * @brief Maps each layout name to its index in `table`, or NO_SLOT.
+   */
+  template <typename T>
+  static void resolve_slots(const LiveView::DeviceTable<T>& table,
+    const std::vector<std::string>& names, std::vector<size_t>& slots) {
+    std::map<std::string, size_t> index;
+    for (size_t i = 0; i < table.size(); ++i)
+      index.emplace(table[i].name, i);
+    slots.assign(names.size(), NO_SLOT);
+    for (size_t i = 0; i < names.size(); ++i) {
+      auto it = index.find(names[i]);
+      if (it != index.end())
+        slots[i] = it->second;
+    }
+  }
+
+  /**
+   * @brief Fills `row` from the per-core times and the device tables of
+   * the current collect().
+   */
+  void fill_row(double disk_ms, double net_ms) {
+    double* out = row.data();
+    for (size_t i = 0; i < layoutCores; ++i, ++out) {
+      *out = 0.0;
+      if (i < prevCores.size() && i < currCores.size())
+        *out = calc_cpu_usage(prevCores[i], currCores[i]);
+    }
+    const double MiB = 1024.0 * 1024.0;
+    const auto& disks = disk.last_stats();
+    if (disks.membership() != diskMembership) {
+      resolve_slots(disks, layoutDisks, diskSlots);
+      diskMembership = disks.membership();
+    }
+    for (size_t slot : diskSlots) {
+      out[0] = out[1] = 0.0;
+      if (slot != NO_SLOT && disk_ms > 0) {
+        const auto& e = disks[slot];
+        if (e.present && e.hasPrevious) {
+          out[0] = (e.value.sectors_read - e.previous.sectors_read) * 512.0 /
+            MiB / (disk_ms / 1000.0);
+          out[1] = (e.value.sectors_written - e.previous.sectors_written) *
+            512.0 / MiB / (disk_ms / 1000.0);
+        }
+      }
+      out += 2;
+    }
+    const auto& nets = net.last_stats();
+    if (nets.membership() != netMembership) {
+      resolve_slots(nets, layoutInterfaces, netSlots);
+      netMembership = nets.membership();
+    }
+    for (size_t slot : netSlots) {
+      out[0] = out[1] = 0.0;
+      if (slot != NO_SLOT && net_ms > 0) {
+        const auto& e = nets[slot];
+        if (e.present && e.hasPrevious) {
+          out[0] = (e.value.bytes_received - e.previous.bytes_received) /
+            MiB / (net_ms / 1000.0);
+          out[1] = (e.value.bytes_transmitted - e.previous.bytes_transmitted) /
+            MiB / (net_ms / 1000.0);
+        }
+      }
+      out += 2;
+    }
+  }
+
+  // Recording: the frame is filled by collect() and written by record(),
+  // both on the collector thread; recordMutex guards the writer.
+  std::mutex recordMutex;
+  std::unique_ptr<LiveView::RecordingWriter> recorder;
+  std::atomic<bool> recording{ false };
+  std::atomic<bool> recordSensors{ false };
+  LiveView::RecordedFrame frame;
+  std::vector<LiveView::SensorReading> sensorReadings;
+
+  /**
+   * @brief Copies the raw counters behind a sample into the frame.
+   */
+  void fill_frame(const LiveSample& sample) {
+    frame.sections = 0;
+    frame.timestamp_ns = sample.timestamp_ns;
+    frame.wall_time_ns = sample.wall_time_ns;
+    record_cpu_times(cpu.last_times(), frame);
+    frame.mem_total_bytes = static_cast<long long>(sample.ram_total_bytes);
+    frame.mem_available_bytes = static_cast<long long>(
+      sample.ram_total_bytes - sample.ram_used_bytes);
+    frame.sections |= LiveView::RECORD_MEMORY;
+    LiveView::record_disks(disk.last_stats(), frame);
+    LiveView::record_networks(net.last_stats(), frame);
+    if (recordSensors.load()) {
+      LiveView::SensorSession::instance().read_all(sensorReadings);
+      size_t n = sensorReadings.size();
+      frame.sensor_labels.resize(n);
+      frame.sensor_chips.resize(n);
+      frame.sensor_types.resize(n);
+      frame.sensor_values.resize(n);
+      for (size_t i = 0; i < n; ++i) {
+        const LiveView::SensorReading& r = sensorReadings[i];
+        frame.sensor_labels[i] = r.label;
+        frame.sensor_chips[i] = r.chip;
+        frame.sensor_types[i] = r.type;
+        frame.sensor_values[i] = r.value;
+      }
+      frame.sections |= LiveView::RECORD_SENSORS;
+    }
+  }
+
+  /**
+   * @brief Appends the frame of the last collect() to the recording.
+   */
+  void record() {
+    if (!recording.load() || frame.sections == 0)
+      return;
+    std::lock_guard<std::mutex> lock(recordMutex);
+    if (recorder)
+      recorder->write(frame);
+  }
+
+  // Publishing: publish() copies every sample into the shared-memory
+  // segment on the collector thread; publishMutex guards the writer.
+  std::mutex publishMutex;
+  std::unique_ptr<LiveView::SharedMetricsWriter> publisher;
+  std::atomic<bool> publishing{ false };
+
+  /**
+   * @brief Publishes a sample to the shared-memory segment, if any.
+   */
+  void publish(const LiveSample& sample) {
+    if (!publishing.load())
+      return;
+    LiveView::SharedSample shared;
+    shared.timestamp_ns = sample.timestamp_ns;
+    shared.wall_time_ns = sample.wall_time_ns;
+    shared.interval_ms = sample.interval_ms;
+    shared.cpu_usage = sample.cpu_usage;
+    shared.ram_usage = sample.ram_usage;
+    shared.ram_used_bytes = sample.ram_used_bytes;
+    shared.ram_total_bytes = sample.ram_total_bytes;
+    shared.disk_read_MBps = sample.disk_read_MBps;
+    shared.disk_write_MBps = sample.disk_write_MBps;
+    shared.net_MBps = sample.net_MBps;
+    shared.sample_count = ring.total();
+    shared.error_count = errors.load();
+    std::lock_guard<std::mutex> lock(publishMutex);
+    if (publisher)
+      publisher->publish(shared);
+  }
+#endif
+
+  /**
+   * @brief Reads every collector once. Rates cover the time since the
+   * previous call.
+   */
+  LiveSample collect() {
+    LiveSample sample;
+    sample.timestamp_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+    sample.wall_time_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::system_clock::now().time_since_epoch()).count();
+
+    auto cpuDelta = cpu.get_usage_delta();
+    sample.cpu_usage = cpuDelta.first;
+    sample.interval_ms = cpuDelta.second;
+
+    auto ramRaw = std::get<std::vector<double>>(ram.get_usage(true));
+    sample.ram_used_bytes = ramRaw[0];
+    sample.ram_total_bytes = ramRaw[1];
+    if (sample.ram_total_bytes > 0)
+      sample.ram_usage = sample.ram_used_bytes / sample.ram_total_bytes * 100.0;
+
+    auto diskDelta = disk.get_usage_delta();
+    auto& rw = std::get<std::vector<std::pair<std::string, double>>>(
+      diskDelta.first);
+    sample.disk_read_MBps = rw[0].second;
+    sample.disk_write_MBps = rw[1].second;
+
+    auto netDelta = net.get_usage_delta(0);
+    sample.net_MBps = std::get<double>(netDelta.first);
+#ifdef __linux__
+    get_per_core_cpu_times(coreBuffer, currCores);
+    if (hasLayout)
+      fill_row(diskDelta.second, netDelta.second);
+    prevCores.swap(currCores);
+    frame.sections = 0;
+    if (recording.load())
+      fill_frame(sample);
+#endif
+    return sample;
+  }
+
+  void run() {
+    auto next = std::chrono::steady_clock::now();
+    std::unique_lock<std::mutex> lock(waitMutex);
+    while (running.load()) {
+      next += std::chrono::milliseconds(interval_ms.load());
+      if (waitCv.wait_until(lock, next, [this] { return !running.load(); }))
+        break;
+      lock.unlock();
+      try {
+        LiveSample sample = collect();
+        ring.push(sample, row.empty() ? nullptr : row.data());
+#ifdef __linux__
+        record();
+        publish(sample);
+#endif
+      }
+      catch (...) {
+        ++errors;
+      }
+      lock.lock();
+      // Do not burst to catch up if a collection overran the cadence
+      auto now = std::chrono::steady_clock::now();
+      if (next < now)
+        next = now;
+    }
+  }
+
+public:
+  /**
+   * @brief Constructs a sampler service (not started).
+   * @param interval_ms Sampling cadence in milliseconds.
+   * @param capacity Number of samples kept in the history ring.
+   */
+  PySamplerService(int interval_ms = 1000, size_t capacity = 3600)
+    : ring(capacity), interval_ms(interval_ms) {
+    if (interval_ms <= 0)
+      throw std::invalid_argument("Sampler interval must be positive.");
+  }
+
+  ~PySamplerService() { stop(); }
+
+  /**
+   * @brief Primes all collectors and starts the background thread.
+   */
+  void start() {
+    if (running.load())
+      return;
+    collect(); // Prime the delta snapshots; errors propagate to the caller
+#ifdef __linux__
+    if (!hasLayout)
+      make_layout();
+    record();
+#endif
+    running.store(true);
+    worker = std::thread(&PySamplerService::run, this);
+  }
+
+  /**
+   * @brief Stops the background thread and waits for it to exit.
+   */
+  void stop() {
+    {
+      std::lock_guard<std::mutex> lock(waitMutex);
+      running.store(false);
+    }
+    waitCv.notify_all();
+    if (worker.joinable()) {
+      HV_GIL_RELEASE;
+      worker.join();
+    }
+  }
+
+  bool is_running() const { return running.load(); }
+
+  /**
+   * @brief Gets the most recent sample without blocking.
+   * @return The sample, or an empty optional if none was collected yet.
+   */
+  std::optional<LiveSample> latest() const {
+    LiveSample sample;
+    if (!ring.latest(sample))
+      return std::nullopt;
+    return sample;
+  }
+
+  /**
+   * @brief Gets up to `count` of the most recent samples, oldest first.
+   * @param count Number of samples; 0 returns the whole ring.
+   */
+  std::vector<LiveSample> history(size_t count = 0) const {
+    std::vector<LiveSample> result;
+    ring.history(result, count ? count : ring.size());
+    return result;
+  }
+#ifndef LIVEVIEW_CPP
+  /**
+   * @brief One copy of the history: the samples and their per-core and
+   * per-device values (ring.row_width() per sample).
+   */
+  struct HistorySnapshot {
+    std::vector<LiveSample> samples;
+    std::vector<double> rows;
+  };
+
+  /**
+   * @brief Copies the ring once into a native snapshot owned by the
+   * returned capsule, which the NumPy arrays over it keep alive.
+   */
+  std::pair<const HistorySnapshot*, py::capsule> snapshot(size_t count,
+    bool rows) const {
+    static std::once_flag dtype;
+    register_numpy_dtype(dtype, [] {
+      PYBIND11_NUMPY_DTYPE(LiveSample, timestamp_ns, wall_time_ns,
+        interval_ms, cpu_usage, ram_usage, ram_used_bytes, ram_total_bytes,
+        disk_read_MBps, disk_write_MBps, net_MBps);
+    });
+    auto snap = std::make_unique<HistorySnapshot>();
+    {
+      HV_GIL_RELEASE;
+      ring.history(snap->samples, count ? count : ring.size(),
+        rows ? &snap->rows : nullptr);
+    }
+    const HistorySnapshot* data = snap.get();
+    py::capsule owner(snap.release(), [](void* p) {
+      delete static_cast<HistorySnapshot*>(p);
+    });
+    return { data, owner };
+  }
+
+  /**
+   * @brief Same as history(), as a NumPy structured array with one field
+   * per LiveSample attribute. The ring is copied once into a native buffer
+   * that the array owns through a capsule: no Python object is created per
+   * sample, and field views (array["cpu_usage"]) share that buffer.
+   */
+  py::array_t<LiveSample> history_array(size_t count = 0) const {
+    auto snap = snapshot(count, false);
+    return py::array_t<LiveSample>(
+      static_cast<py::ssize_t>(snap.first->samples.size()),
+      snap.first->samples.data(), snap.second);
+  }
+
+  /**
+   * @brief history_array() split into one typed 1-D array per attribute
+   * (int64 timestamps, float64 values), plus (Linux only) 2-D arrays of the
+   * per-core and per-device values, one row per sample and one column per
+   * entry of history_layout(). All are views of the same buffer.
+   */
+  py::dict history_columns(size_t count = 0) const {
+    auto snap = snapshot(count, true);
+    const HistorySnapshot& data = *snap.first;
+    py::array_t<LiveSample> records(
+      static_cast<py::ssize_t>(data.samples.size()), data.samples.data(),
+      snap.second);
+    py::dict columns;
+    for (const char* name : { "timestamp_ns", "wall_time_ns", "interval_ms",
+      "cpu_usage", "ram_usage", "ram_used_bytes", "ram_total_bytes",
+      "disk_read_MBps", "disk_write_MBps", "net_MBps" })
+      columns[name] = records[py::str(name)];
+#ifdef __linux__
+    const py::ssize_t n = static_cast<py::ssize_t>(data.samples.size());
+    const py::ssize_t width = static_cast<py::ssize_t>(ring.row_width());
+    auto view = [&](size_t offset, size_t step, size_t entries) {
+      std::vector<py::ssize_t> shape{ n, static_cast<py::ssize_t>(entries) };
+      std::vector<py::ssize_t> strides{
+        width * static_cast<py::ssize_t>(sizeof(double)),
+        static_cast<py::ssize_t>(step * sizeof(double)) };
+      return py::array_t<double>(shape, strides,
+        data.rows.empty() ? nullptr : data.rows.data() + offset, snap.second);
+    };
+    size_t disks = layoutDisks.size();
+    size_t nets = layoutInterfaces.size();
+    size_t netBase = layoutCores + 2 * disks;
+    columns["core_usage"] = view(0, 1, layoutCores);
+    columns["disk_read_MBps_per_device"] = view(layoutCores, 2, disks);
+    columns["disk_write_MBps_per_device"] = view(layoutCores + 1, 2, disks);
+    columns["net_rx_MBps_per_interface"] = view(netBase, 2, nets);
+    columns["net_tx_MBps_per_interface"] = view(netBase + 1, 2, nets);
+#endif
+    return columns;
+  }
+#ifdef __linux__
+  /**
+   * @brief (Linux only) What the columns of the 2-D history_columns()
+   * arrays are: "cores" (core numbers), "disks" and "interfaces" (names).
+   * Fixed by the first start(); empty before it.
+   */
+  py::dict history_layout() const {
+    py::dict layout;
+    std::vector<int> cores;
+    for (size_t i = 0; i < layoutCores; ++i)
+      cores.push_back(static_cast<int>(i));
+    layout["cores"] = cores;
+    layout["disks"] = layoutDisks;
+    layout["interfaces"] = layoutInterfaces;
+    return layout;
+  }
+#endif
+#endif
+
+  void set_interval(int ms) {
+    if (ms <= 0)
+      throw std::invalid_argument("Sampler interval must be positive.");
+    interval_ms.store(ms);
+  }
+  int get_interval() const { return interval_ms.load(); }
+
+  /**
+   * @brief Total number of samples collected since the service was created.
+   */
+  uint64_t sample_count() const { return ring.total(); }
+
+  /**
+   * @brief Size of the history ring.
+   */
+  size_t capacity() const { return ring.size(); }
+
+  /**
+   * @brief Number of collection passes that failed with an exception.
+   */
+  uint64_t get_error_count() const { return errors.load(); }
+
+#ifdef __linux__
+  /**
+   * @brief (Linux only) Appends the raw counters of every pass to a
+   * recording file until stop_recording(); see PyLiveReplay.
+   * @param path File to create, or an existing recording to append to.
+   * @param sensors Also record the value of every sensor.
+   */
+  void start_recording(const std::string& path, bool sensors = false) {
+    auto writer = std::make_unique<LiveView::RecordingWriter>(path);
+    std::lock_guard<std::mutex> lock(recordMutex);
+    recorder = std::move(writer);
+    recordSensors.store(sensors);
+    recording.store(true);
+  }
+
+  /**
+   * @brief (Linux only) Stops recording and closes the file.
+   */
+  void stop_recording() {
+    std::lock_guard<std::mutex> lock(recordMutex);
+    recording.store(false);
+    recorder.reset();
+  }
+
+  bool is_recording() const { return recording.load(); }
+
+  /**
+   * @brief (Linux only) Publishes every sample into a POSIX shared-memory
+   * segment (/dev/shm/<name>) until stop_publishing(), so other processes
+   * can read it with PySharedMetricsReader instead of sampling themselves.
+   * @param name Segment name; one publisher per name at a time.
+   */
+  void start_publishing(
+      const std::string& name = LiveView::SHARED_METRICS_DEFAULT_NAME) {
+    auto writer = std::make_unique<LiveView::SharedMetricsWriter>(name);
+    std::lock_guard<std::mutex> lock(publishMutex);
+    publisher = std::move(writer);
+    publishing.store(true);
+  }
+
+  /**
+   * @brief (Linux only) Stops publishing and removes the segment.
+   */
+  void stop_publishing() {
+    std::lock_guard<std::mutex> lock(publishMutex);
+    publishing.store(false);
+    publisher.reset();
+  }
+
+  bool is_publishing() const { return publishing.load(); }
+#endif
+};
+
+#ifdef __linux__
+/**
+ * @class PyLiveReplay
+ * @brief (Linux only) Replays a PySamplerService recording through the same
+ * rate computations as the live collectors, as fast as possible or at a
+ * multiple of real time.
+ */
+class PyLiveReplay {
+private:
+  LiveView::RecordingReader reader;
+  LiveView::RecordedFrame frame;
+  LiveView::DeviceTable<DiskStats> disks;
+  LiveView::DeviceTable<NetworkStats> networks;
+  CpuTimes prevCpu{};
+  int64_t prevTimestamp = 0;
+  bool primed = false;
+
+  /**
+   * @brief Computes the sample of the next frame from the one before it.
+   * @return False at the end of the recording.
+   */
+  bool advance(LiveSample& sample) {
+    while (reader.next(frame)) {
+      CpuTimes cpu = replay_cpu_times(frame);
+      // Runs appended to the same file follow each other; a clock or a
+      // counter going backwards (e.g. after a reboot) starts a new one.
+      bool restart = !primed || frame.timestamp_ns <= prevTimestamp ||
+        get_total_time(cpu) < get_total_time(prevCpu);
+      if (restart) {
+        disks = LiveView::DeviceTable<DiskStats>();
+        networks = LiveView::DeviceTable<NetworkStats>();
+      }
+      LiveView::replay_devices(frame.disks, disks);
+      LiveView::replay_devices(frame.networks, networks);
+      double interval_sec =
+        restart ? 0.0 : (frame.timestamp_ns - prevTimestamp) / 1e9;
+      if (!restart) {
+        sample = LiveSample();
+        sample.timestamp_ns = frame.timestamp_ns;
+        sample.wall_time_ns = frame.wall_time_ns;
+        sample.interval_ms = interval_sec * 1000.0;
+        sample.cpu_usage = calc_cpu_usage(prevCpu, cpu);
+        sample.ram_total_bytes = static_cast<double>(frame.mem_total_bytes);
+        sample.ram_used_bytes = static_cast<double>(
+          frame.mem_total_bytes - frame.mem_available_bytes);
+        if (sample.ram_total_bytes > 0)
+          sample.ram_usage =
+            sample.ram_used_bytes / sample.ram_total_bytes * 100.0;
+        auto rw = calc_disk_rates(disks, interval_sec);
+        sample.disk_read_MBps = rw[0].second;
+        sample.disk_write_MBps = rw[1].second;
+        sample.net_MBps =
+          std::get<double>(calc_network_usage(networks, interval_sec, 0));
+      }
+      prevCpu = cpu;
+      prevTimestamp = frame.timestamp_ns;
+      primed = true;
+      if (!restart)
+        return true;
+    }
+    return false;
+  }
+
+public:
+  /**
+   * @param path A recording made by PySamplerService.start_recording().
+   */
+  explicit PyLiveReplay(const std::string& path) : reader(path) {}
+
+  /**
+   * @brief Gets the next sample. The first frame of every run only primes
+   * the counters, as PySamplerService.start() does.
+   * @return The sample, or an empty optional at the end of the recording.
+   */
+  std::optional<LiveSample> next() {
+    LiveSample sample;
+    if (!advance(sample))
+      return std::nullopt;
+    return sample;
+  }
+
+  /**
+   * @brief Replays up to `count` samples as fast as possible.
+   * @param count Number of samples; 0 reads to the end of the recording.
+   */
+  std::vector<LiveSample> read(size_t count = 0) {
+    HV_GIL_RELEASE;
+    std::vector<LiveSample> result;
+    LiveSample sample;
+    while ((count == 0 || result.size() < count) && advance(sample))
+      result.push_back(sample);
+    return result;
+  }
+
+  /**
+   * @brief Replays the rest of the recording, calling `callback` with each
+   * sample at the recorded cadence divided by `speed`.
+   * @param speed 1 for real time, 1000 for 1000x; 0 or less for as fast as
+   * possible.
+   * @return The number of samples replayed.
+   */
+  uint64_t play(const std::function<void(const LiveSample&)>& callback,
+    double speed = 1.0) {
+    HV_GIL_RELEASE; // The callback takes the GIL back while it runs
+    uint64_t count = 0;
+    LiveSample sample;
+    auto start = std::chrono::steady_clock::now();
+    int64_t firstTimestamp = 0;
+    while (advance(sample)) {
+      if (count == 0)
+        firstTimestamp = sample.timestamp_ns;
+      if (speed > 0) {
+        auto offset = std::chrono::nanoseconds(static_cast<int64_t>(
+          (sample.timestamp_ns - firstTimestamp) / speed));
+        std::this_thread::sleep_until(start + offset);
+      }
+      callback(sample);
+      ++count;
+    }
+    return count;
+  }
+
+  /**
+   * @brief The sensors of the current frame as (label, value, chip, type),
+   * like PyLinuxSensor.get_all_sensors(). Empty if they were not recorded.
+   */
+  std::vector<std::tuple<std::string, double, std::string, std::string>>
+    get_sensors() const {
+    std::vector<std::tuple<std::string, double, std::string, std::string>>
+      sensors;
+    size_t n = frame.sensor_values.size();
+    if (frame.sensor_labels.size() < n)
+      n = frame.sensor_labels.size();
+    sensors.reserve(n);
+    for (size_t i = 0; i < n; ++i)
+      sensors.emplace_back(frame.sensor_labels[i], frame.sensor_values[i],
+        frame.sensor_chips[i], frame.sensor_types[i]);
+    return sensors;
+  }
+
+  /**
+   * @brief Starts over from the first frame.
+   */
+  void rewind() {
+    reader.rewind();
+    primed = false;
+  }
+
+  /**
+   * @brief Frames read so far, priming frames included.
+   */
+  uint64_t frame_count() const { return reader.frame_count(); }
+};
+
+/**
+ * @class PyMetricsExporter
+ * @brief (Linux only) Serves the latest PySamplerService values as Prometheus /
+ * OpenMetrics text on http://<address>:<port>/metrics.
+ *
+ * Metric names, HELP/TYPE lines and label sets are rendered once; a scrape
+ * re-renders only the numbers, and only when the sampler has collected a new
+ * sample since the previous scrape. Otherwise it is a buffer copy.
+ */
+class PyMetricsExporter {
+private:
+  // Value slots, in the order the series are added to the template. The
+  // counters come first: they are the only series served before the first
+  // sample.
+  enum Slot {
+    SLOT_SAMPLES,
+    SLOT_ERRORS,
+    SLOT_CPU,
+    SLOT_RAM,
+    SLOT_RAM_USED,
+    SLOT_RAM_TOTAL,
+    SLOT_DISK_READ,
+    SLOT_DISK_WRITE,
+    SLOT_NETWORK,
+    SLOT_INTERVAL,
+    SLOT_TIMESTAMP,
+    SLOT_COUNT
+  };
+
+  const PySamplerService& sampler;
+  LiveView::MetricsTemplate metrics;
+  LiveView::MetricsServer server;
+  double values[SLOT_COUNT] = {};
+  // Rendered body per format and the sampler counters it was rendered at;
+  // only touched on the server thread.
+  std::string body[2];
+  uint64_t renderedSamples[2] = { UINT64_MAX, UINT64_MAX };
+  uint64_t renderedErrors[2] = { UINT64_MAX, UINT64_MAX };
+
+  static LiveView::MetricsTemplate
+  build_template(const std::map<std::string, std::string>& labels) {
+    using LiveView::METRIC_COUNTER;
+    using LiveView::METRIC_GAUGE;
+    LiveView::MetricsTemplate t(
+        LiveView::MetricLabels(labels.begin(), labels.end()));
+    t.add_family("hardview_sampler_samples",
+                 "Samples collected by the sampler.", METRIC_COUNTER);
+    t.add_series();
+    t.add_family("hardview_sampler_errors",
+                 "Sampler collection passes that failed.", METRIC_COUNTER);
+    t.add_series();
+    t.add_family("hardview_cpu_usage_percent", "Total CPU usage.",
+                 METRIC_GAUGE);
+    t.add_series();
+    t.add_family("hardview_memory_usage_percent", "Physical memory in use.",
+                 METRIC_GAUGE);
+    t.add_series();
+    t.add_family("hardview_memory_used_bytes",
+                 "Physical memory in use, in bytes.", METRIC_GAUGE);
+    t.add_series();
+    t.add_family("hardview_memory_total_bytes", "Total physical memory.",
+                 METRIC_GAUGE);
+    t.add_series();
+    t.add_family("hardview_disk_throughput_bytes_per_second",
+                 "Read and write throughput of all physical disks.",
+                 METRIC_GAUGE);
+    t.add_series({{"direction", "read"}});
+    t.add_series({{"direction", "write"}});
+    t.add_family("hardview_network_throughput_bytes_per_second",
+                 "Received plus transmitted bytes of all interfaces.",
+                 METRIC_GAUGE);
+    t.add_series();
+    t.add_family("hardview_sample_interval_seconds",
+                 "Time covered by the rates of the latest sample.",
+                 METRIC_GAUGE);
+    t.add_series();
+    t.add_family("hardview_sample_timestamp_seconds",
+                 "Wall-clock time of the latest sample (Unix time).",
+                 METRIC_GAUGE);
+    t.add_series();
+    return t;
+  }
+
+  /**
+   * @brief Body of one scrape; re-rendered only if the sampler moved on.
+   */
+  const std::string& scrape(LiveView::MetricsFormat format) {
+    uint64_t samples = sampler.sample_count();
+    uint64_t errors = sampler.get_error_count();
+    if (samples == renderedSamples[format] && errors == renderedErrors[format])
+      return body[format];
+
+    size_t count = SLOT_CPU;
+    values[SLOT_SAMPLES] = static_cast<double>(samples);
+    values[SLOT_ERRORS] = static_cast<double>(errors);
+    if (auto sample = sampler.latest()) {
+      const double MiB = 1024.0 * 1024.0;
+      values[SLOT_CPU] = sample->cpu_usage;
+      values[SLOT_RAM] = sample->ram_usage;
+      values[SLOT_RAM_USED] = sample->ram_used_bytes;
+      values[SLOT_RAM_TOTAL] = sample->ram_total_bytes;
+      values[SLOT_DISK_READ] = sample->disk_read_MBps * MiB;
+      values[SLOT_DISK_WRITE] = sample->disk_write_MBps * MiB;
+      values[SLOT_NETWORK] = sample->net_MBps * MiB;
+      values[SLOT_INTERVAL] = sample->interval_ms / 1000.0;
+      values[SLOT_TIMESTAMP] = sample->wall_time_ns / 1e9;
+      count = SLOT_COUNT;
+    }
+    metrics.render(values, count, format, body[format]);
+    renderedSamples[format] = samples;
+    renderedErrors[format] = errors;
+    return body[format];
   }
 
+public:
   /**
-   * @brief Gets the disk usage based on the mode set in the constructor.
-   * @param interval The interval in milliseconds between measurements.
-   * @return A double for percentage usage or a vector of {read_MBps,
-   * write_MBps}.
+   * @brief Creates an exporter (not started). The sampler must outlive it.
+   * @param sampler The sampler whose latest values are served; it is not
+   * started or stopped by the exporter.
+   * @param address Numeric IPv4/IPv6 address to listen on.
+   * @param port TCP port; 0 picks a free one (see get_port()).
+   * @param labels Constant labels added to every series.
    */
-  std::variant<double, std::vector<std::pair<std::string, double>>>
-    get_usage(int interval = 1000) {
-#ifdef _WIN32
-    HV_GIL_RELEASE;
-    Sleep(interval);
-    if (PdhCollectQueryData(query) != ERROR_SUCCESS)
-      throw std::runtime_error("Disk Monitor: Failed to collect query data.");
+  PyMetricsExporter(const PySamplerService& sampler,
+    const std::string& address = "127.0.0.1", int port = 9101,
+    const std::map<std::string, std::string>& labels = {})
+    : sampler(sampler), metrics(build_template(labels)),
+    server(address, port,
+      [this](LiveView::MetricsFormat format) -> const std::string& {
+        return scrape(format);
+      }) {}
 
-    if (mode == 0) {
-      PDH_FMT_COUNTERVALUE value;
-      if (PdhGetFormattedCounterValue(counter, PDH_FMT_DOUBLE, NULL, &value) !=
-        ERROR_SUCCESS)
-        throw std::runtime_error("Disk Monitor: Failed to read '% Disk Time'.");
-      if (value.CStatus != ERROR_SUCCESS) {
-        return -0.1;
-      }
-      return value.doubleValue;
-    }
-    else { // mode == 1
-      PDH_FMT_COUNTERVALUE valueRead, valueWrite;
-      if (PdhGetFormattedCounterValue(readCounter, PDH_FMT_DOUBLE, NULL,
-        &valueRead) != ERROR_SUCCESS)
-        throw std::runtime_error(
-          "Disk Monitor: Failed to read 'Disk Read Bytes/sec'.");
-      if (PdhGetFormattedCounterValue(writeCounter, PDH_FMT_DOUBLE, NULL,
-        &valueWrite) != ERROR_SUCCESS)
-        throw std::runtime_error(
-          "Disk Monitor: Failed to read 'Disk Write Bytes/sec'.");
-      if (valueRead.CStatus != ERROR_SUCCESS ||
-        valueWrite.CStatus != ERROR_SUCCESS) {
-        return std::vector<std::pair<std::string, double>>{
-          {"Read MB/s", -0.1}, { "Write MB/s", -0.1 }};
-      }
-      double read_MBps = valueRead.doubleValue / (1024.0 * 1024.0);
-      double write_MBps = valueWrite.doubleValue / (1024.0 * 1024.0);
-      return std::vector<std::pair<std::string, double>>{
-        {"Read MB/s", read_MBps}, { "Write MB/s", write_MBps }};
-    }
-#elif __linux__
-    auto start_stats = get_disk_stats();
+  ~PyMetricsExporter() { stop(); }
+
+  /**
+   * @brief Binds the address and starts serving /metrics.
+   */
+  void start() { server.start(); }
+
+  void stop() {
     HV_GIL_RELEASE;
-    std::this_thread::sleep_for(std::chrono::milliseconds(interval));
-    auto end_stats = get_disk_stats();
-
-    long long total_sectors_read = 0;
-    long long total_sectors_written = 0;
-    for (auto const& [dev, end_stat] : end_stats) {
-      if (start_stats.count(dev)) {
-        total_sectors_read +=
-          end_stat.sectors_read - start_stats.at(dev).sectors_read;
-        total_sectors_written +=
-          end_stat.sectors_written - start_stats.at(dev).sectors_written;
-      }
-    }
-    double interval_sec = static_cast<double>(interval) / 1000.0;
-    double read_MBps =
-      (total_sectors_read * 512.0) / (1024.0 * 1024.0) / interval_sec;
-    double write_MBps =
-      (total_sectors_written * 512.0) / (1024.0 * 1024.0) / interval_sec;
-    return std::vector<std::pair<std::string, double>>{
-      {"Read MB/s", read_MBps}, { "Write MB/s", write_MBps }};
-#endif
+    server.stop();
   }
 
+  bool is_running() const { return server.is_running(); }
+
   /**
-   * @brief (Mode 1 only) Checks if disk R/W speed exceeds a threshold.
-   * @param threshold_mbps The threshold in MB/s.
-   * @return True if usage is high, false otherwise.
+   * @brief The port being served (0 while stopped).
    */
-  bool HighDiskUsage(double threshold_mbps = 80.0) {
-    if (mode != 1) {
-      throw std::runtime_error("HighDiskUsage() can only be called in mode 1.");
-    }
-    auto usage =
-      std::get<std::vector<std::pair<std::string, double>>>(get_usage(1000));
-    return usage[0].second > threshold_mbps || usage[1].second > threshold_mbps;
-  }
+  int get_port() const { return server.port(); }
+
+  std::string get_address() const { return server.get_address(); }
+
+  /**
+   * @brief Number of /metrics requests answered.
+   */
+  uint64_t scrape_count() const { return server.scrape_count(); }
 };
 
 /**
- * @class PyLiveNetwork
- * @brief Provides network I/O monitoring functionalities.
+ * @class PySharedMetricsReader
+ * @brief (Linux only) Reads the samples another process publishes with
+ * PySamplerService.start_publishing(). A read is a copy out of shared
+ * memory: no system call, no lock, no collection.
  */
-class PyLiveNetwork {
+class PySharedMetricsReader {
 private:
-#ifdef _WIN32
-  PDH_HQUERY query = nullptr;
-  PDH_HCOUNTER counter = nullptr;
-#endif
+  LiveView::SharedMetricsReader reader;
 
-public:
-  PyLiveNetwork() {
-#ifdef _WIN32
-    if (PdhOpenQuery(NULL, 0, &query) != ERROR_SUCCESS)
-      throw std::runtime_error("Network Monitor: Failed to open PDH query.");
-    // Use the English counter name to be locale-independent
-    if (PdhAddEnglishCounterW(query, L"\\Network Interface(*)\\Bytes Total/sec",
-      0, &counter) != ERROR_SUCCESS)
-      throw std::runtime_error(
-        "Network Monitor: Failed to add 'Bytes Total/sec' counter.");
-    PdhCollectQueryData(query);
-#endif
+  LiveView::SharedSample read_shared() const {
+    LiveView::SharedSample shared;
+    if (!reader.read(shared))
+      shared.sample_count = 0;
+    return shared;
   }
 
-  ~PyLiveNetwork() {
-#ifdef _WIN32
-    if (query)
-      PdhCloseQuery(query);
-#endif
+public:
+  explicit PySharedMetricsReader(
+    const std::string& name = LiveView::SHARED_METRICS_DEFAULT_NAME)
+    : reader(name) {}
+
+  /**
+   * @brief Gets the latest published sample.
+   * @return The sample, or an empty optional if none was published yet.
+   */
+  std::optional<LiveSample> read() const {
+    LiveView::SharedSample shared;
+    if (!reader.read(shared))
+      return std::nullopt;
+    LiveSample sample;
+    sample.timestamp_ns = shared.timestamp_ns;
+    sample.wall_time_ns = shared.wall_time_ns;
+    sample.interval_ms = shared.interval_ms;
+    sample.cpu_usage = shared.cpu_usage;
+    sample.ram_usage = shared.ram_usage;
+    sample.ram_used_bytes = shared.ram_used_bytes;
+    sample.ram_total_bytes = shared.ram_total_bytes;
+    sample.disk_read_MBps = shared.disk_read_MBps;
+    sample.disk_write_MBps = shared.disk_write_MBps;
+    sample.net_MBps = shared.net_MBps;
+    return sample;
   }
 
   /**
-   * @brief Gets network usage.
-   * @param interval The interval in milliseconds.
-   * @param mode 0 for total speed (MB/s), 1 for per-interface speed (MB/s).
-   * @return Total speed as a double or per-interface speeds as a vector of
-   * pairs.
+   * @brief Samples collected by the publisher so far.
    */
-  std::variant<double, std::vector<std::pair<std::string, double>>>
-    get_usage(int interval = 1000, int mode = 0) {
-#ifdef _WIN32
-    HV_GIL_RELEASE;
-    Sleep(interval);
-    if (PdhCollectQueryData(query) != ERROR_SUCCESS)
-      throw std::runtime_error(
-        "Network Monitor: Failed to collect query data.");
+  uint64_t sample_count() const { return read_shared().sample_count; }
 
-    DWORD bufferSize = 0, itemCount = 0;
-    PDH_FMT_COUNTERVALUE_ITEM_W* items = nullptr;
-    auto status = PdhGetFormattedCounterArrayW(
-      counter, PDH_FMT_DOUBLE, &bufferSize, &itemCount, nullptr);
-    if (status != PDH_MORE_DATA)
-      throw std::runtime_error("Network Monitor: Failed to get buffer size for "
-        "counter array. PDH Error: " +
-        std::to_string(status));
+  /**
+   * @brief Failed collection passes of the publisher.
+   */
+  uint64_t get_error_count() const { return read_shared().error_count; }
 
-    std::vector<BYTE> buffer(bufferSize);
-    items = reinterpret_cast<PDH_FMT_COUNTERVALUE_ITEM_W*>(buffer.data());
+  int publisher_pid() const { return reader.publisher_pid(); }
+  bool publisher_alive() const { return reader.publisher_alive(); }
+  std::string get_name() const { return reader.get_name(); }
+};
+#endif
 
-    if (PdhGetFormattedCounterArrayW(counter, PDH_FMT_DOUBLE, &bufferSize,
-      &itemCount, items) != ERROR_SUCCESS) {
-      throw std::runtime_error(
-        "Network Monitor: Failed to get formatted counter array.");
-    }
+// Subsystem flags for PyLiveSnapshot
+#define SNAPSHOT_CPU 1
+#define SNAPSHOT_RAM 2
+#define SNAPSHOT_DISK 4
+#define SNAPSHOT_NETWORK 8
+#define SNAPSHOT_ALL (SNAPSHOT_CPU | SNAPSHOT_RAM | SNAPSHOT_DISK | SNAPSHOT_NETWORK)
 
-    if (mode == 0) {
-      double totalBytes = 0;
-      for (DWORD i = 0; i < itemCount; ++i) {
-        if (items[i].FmtValue.CStatus != ERROR_SUCCESS)
-          continue;
-        totalBytes += items[i].FmtValue.doubleValue;
-      }
-      return totalBytes / (1024.0 * 1024.0); // Return total MB/s
-    }
-    else {                                 // mode == 1
-      std::vector<std::pair<std::string, double>> result;
-      for (DWORD i = 0; i < itemCount; ++i) {
-        if (items[i].FmtValue.CStatus != ERROR_SUCCESS) {
-          items[i].FmtValue.doubleValue = -0.1;
-        }
-        result.emplace_back(wstring_to_utf8(items[i].szName),
-          items[i].FmtValue.doubleValue / (1024.0 * 1024.0));
-      }
-      return result;
-    }
-#elif __linux__
-    auto start_stats = get_network_stats();
-    HV_GIL_RELEASE;
-    std::this_thread::sleep_for(std::chrono::milliseconds(interval));
-    auto end_stats = get_network_stats();
-    double interval_sec = static_cast<double>(interval) / 1000.0;
+/**
+ * @struct SnapshotResult
+ * @brief Rates of several subsystems measured over one shared interval.
+ * Values of subsystems that were not requested are -1.
+ */
+struct SnapshotResult {
+  double interval_ms = 0; // Actual measured interval
+  double cpu_usage = -1;
+  double ram_usage = -1;
+  double ram_used_bytes = -1;
+  double ram_total_bytes = -1;
+  double disk_read_MBps = -1;
+  double disk_write_MBps = -1;
+  double net_MBps = -1; // Total network traffic (received + transmitted)
+  std::vector<std::pair<std::string, double>> net_interfaces; // Per interface
+};
 
-    if (mode == 0) {
-      long long total_bytes_delta = 0;
-      for (auto const& [iface, end_stat] : end_stats) {
-        if (start_stats.count(iface)) {
-          total_bytes_delta +=
-            (end_stat.bytes_received - start_stats.at(iface).bytes_received);
-          total_bytes_delta += (end_stat.bytes_transmitted -
-            start_stats.at(iface).bytes_transmitted);
-        }
-      }
-      return (total_bytes_delta) / (1024.0 * 1024.0) / interval_sec;
-    }
-    else { // mode == 1
-      std::vector<std::pair<std::string, double>> result;
-      for (auto const& [iface, end_stat] : end_stats) {
-        if (start_stats.count(iface)) {
-          long long bytes_delta =
-            (end_stat.bytes_received - start_stats.at(iface).bytes_received) +
-            (end_stat.bytes_transmitted -
-              start_stats.at(iface).bytes_transmitted);
-          result.emplace_back(iface,
-            (bytes_delta) / (1024.0 * 1024.0) / interval_sec);
-        }
-      }
-      return result;
-    }
-#endif
+/**
+ * @class PyLiveSnapshot
+ * @brief Measures CPU, RAM, disk and network together: takes the "before"
+ * readings of every requested subsystem, waits once, then takes all the
+ * "after" readings, so N subsystems cost one interval instead of N.
+ */
+class PyLiveSnapshot {
+private:
+  int subsystems;
+  PyLiveCPU cpu;
+  PyLiveRam ram;
+  std::unique_ptr<PyLiveDisk> disk;
+  PyLiveNetwork net;
+
+public:
+  /**
+   * @brief Constructs a snapshot collector.
+   * @param subsystems Bitmask of SNAPSHOT_CPU, SNAPSHOT_RAM, SNAPSHOT_DISK and
+   * SNAPSHOT_NETWORK.
+   */
+  PyLiveSnapshot(int subsystems = SNAPSHOT_ALL) : subsystems(subsystems) {
+    if ((subsystems & SNAPSHOT_ALL) == 0)
+      throw std::invalid_argument("No subsystem selected for PyLiveSnapshot.");
+    if (subsystems & SNAPSHOT_DISK)
+      disk = std::make_unique<PyLiveDisk>(1);
   }
 
   /**
-   * @brief Gets the name of the network interface with the highest usage.
-   * @return The name of the adapter as a string.
+   * @brief Measures all requested subsystems over one shared interval.
+   * @param interval_ms The interval in milliseconds.
+   * @return The rates of every requested subsystem.
    */
-  std::string getHighCard() {
-    auto cards = std::get<std::vector<std::pair<std::string, double>>>(
-      get_usage(1000, 1));
-    if (cards.empty())
-      return "N/A";
+  SnapshotResult take(int interval_ms = 1000) {
+    SnapshotResult result;
+    // "Before" readings
+    if (subsystems & SNAPSHOT_CPU)
+      cpu.get_usage_delta();
+    if (disk)
+      disk->get_usage_delta();
+    if (subsystems & SNAPSHOT_NETWORK)
+      net.get_usage_delta(1);
 
-    auto max_it = std::max_element(
-      cards.begin(), cards.end(),
-      [](const auto& a, const auto& b) { return a.second < b.second; });
-    return max_it->first;
+    {
+      HV_GIL_RELEASE;
+      std::this_thread::sleep_for(std::chrono::milliseconds(interval_ms));
+    }
+
+    // "After" readings
+    double elapsed_ms = 0;
+    if (subsystems & SNAPSHOT_CPU) {
+      auto cpuDelta = cpu.get_usage_delta();
+      result.cpu_usage = cpuDelta.first;
+      elapsed_ms = max(elapsed_ms, cpuDelta.second);
+    }
+    if (disk) {
+      auto diskDelta = disk->get_usage_delta();
+      auto& rw = std::get<std::vector<std::pair<std::string, double>>>(
+        diskDelta.first);
+      result.disk_read_MBps = rw[0].second;
+      result.disk_write_MBps = rw[1].second;
+      elapsed_ms = max(elapsed_ms, diskDelta.second);
+    }
+    if (subsystems & SNAPSHOT_NETWORK) {
+      auto netDelta = net.get_usage_delta(1);
+      result.net_interfaces = std::move(
+        std::get<std::vector<std::pair<std::string, double>>>(netDelta.first));
+      result.net_MBps = 0;
+      for (const auto& iface : result.net_interfaces) {
+        if (iface.second > 0)
+          result.net_MBps += iface.second;
+      }
+      elapsed_ms = max(elapsed_ms, netDelta.second);
+    }
+    if (subsystems & SNAPSHOT_RAM) {
+      auto ramRaw = std::get<std::vector<double>>(ram.get_usage(true));
+      result.ram_used_bytes = ramRaw[0];
+      result.ram_total_bytes = ramRaw[1];
+      result.ram_usage = ramRaw[1] > 0 ? ramRaw[0] / ramRaw[1] * 100.0 : 0.0;
+    }
+    result.interval_ms = elapsed_ms > 0 ? elapsed_ms : interval_ms;
+    return result;
   }
 };
 
@@ -1513,8 +3357,26 @@ try {
 
 #endif // _WIN32
 #ifdef __linux__
+/**
+ * @struct SensorRecord
+ * @brief Row of the NumPy array returned by
+ * PyLinuxSensor::get_all_sensors_array().
+ */
+struct SensorRecord {
+  char label[64];
+  double value;
+  char chip[32];
+  char type[16];
+};
+
 class PyLinuxSensor {
 
+  LiveView::SensorSession* session; // Shared by instances with the same backend
+  LiveView::SensorQuery cpuQuery = CpuPackageTempQuery();
+  LiveView::SensorQuery chipsetQuery = ChipsetTempQuery();
+  LiveView::SensorQuery mbQuery = MotherboardTempQuery();
+  LiveView::SensorQuery vrmQuery = VRMTempQuery();
+  LiveView::SensorQuery driveQuery = DriveTempQuery();
   std::vector<std::string> sensors_names; // sensor names
   double cputemp = 0;
   double mbtemp = 0;    // Motherboard temperature
@@ -1522,14 +3384,24 @@ class PyLinuxSensor {
   double memorytemp = 0;
   double storagetemp = 0;
 
+  void read_temps() {
+    cputemp = session->read(cpuQuery);
+    chipstemp = session->read(chipsetQuery);
+    mbtemp = session->read(mbQuery);
+    memorytemp = session->read(vrmQuery);
+    storagetemp = session->read(driveQuery);
+  }
+
 public:
-  PyLinuxSensor() {
-    sensors_names = GetAllSensorNames();
-    cputemp = GetCpuPackageTemp();
-    chipstemp = GetChipsetTemp();
-    mbtemp = GetMotherboardTemp();
-    memorytemp = GetVRMTemp();
-    storagetemp = GetDriveTemp();
+  /**
+   * @param backend SENSOR_BACKEND_AUTO (libsensors, or the hwmon sysfs reader
+   * if libsensors is not installed or fails to initialize),
+   * SENSOR_BACKEND_LIBSENSORS or SENSOR_BACKEND_HWMON.
+   */
+  PyLinuxSensor(int backend = LiveView::SENSOR_BACKEND_AUTO)
+    : session(&LiveView::SensorSession::instance(backend)) {
+    sensors_names = session->labels();
+    read_temps();
   }
   double getCpuTemp() const { return cputemp; }
   double getChipsetTemp() const { return chipstemp; }
@@ -1552,26 +3424,86 @@ public:
     if (name.empty()) {
       return -1;
     }
-    return GetSensorByName(name, Match);
+    LiveView::SensorQuery query = LiveView::SensorQuery::by_name(name, Match);
+    return session->read(query);
   }
+  /**
+   * @brief Label and value of every sensor, read in a single pass.
+   */
   std::vector<std::pair<std::string, double>> GetSensorsWithTemp() const {
+    std::vector<LiveView::SensorReading> readings;
+    {
+      HV_GIL_RELEASE;
+      session->read_all(readings);
+    }
     std::vector<std::pair<std::string, double>> sensors;
-    for (const auto& sensor : sensors_names) {
-      double val = GetSensorByName(sensor, true);
-      auto pair = std::make_pair(sensor, val);
-      sensors.push_back(pair);
+    sensors.reserve(readings.size());
+    for (auto& r : readings)
+      sensors.emplace_back(std::move(r.label), r.value);
+    return sensors;
+  }
+  /**
+   * @brief Every sensor as (label, value, chip, type), read in a single pass.
+   * `type` is the libsensors feature type: "temp", "fan", "in", "power"...
+   */
+  std::vector<std::tuple<std::string, double, std::string, std::string>>
+    get_all_sensors() const {
+    std::vector<LiveView::SensorReading> readings;
+    {
+      HV_GIL_RELEASE;
+      session->read_all(readings);
     }
+    std::vector<std::tuple<std::string, double, std::string, std::string>> sensors;
+    sensors.reserve(readings.size());
+    for (auto& r : readings)
+      sensors.emplace_back(std::move(r.label), r.value, std::move(r.chip), r.type);
     return sensors;
   }
+#ifndef LIVEVIEW_CPP
+  /**
+   * @brief Same as get_all_sensors(), as a NumPy structured array of
+   * SensorRecord (label, value, chip, type). Strings are NUL-padded bytes,
+   * truncated to the field size.
+   */
+  py::array_t<SensorRecord> get_all_sensors_array() const {
+    static std::once_flag dtype;
+    register_numpy_dtype(dtype, [] {
+      PYBIND11_NUMPY_DTYPE(SensorRecord, label, value, chip, type);
+    });
+    std::vector<LiveView::SensorReading> readings;
+    {
+      HV_GIL_RELEASE;
+      session->read_all(readings);
+    }
+    py::array_t<SensorRecord> array(static_cast<py::ssize_t>(readings.size()));
+    SensorRecord* records = array.mutable_data();
+    for (size_t i = 0; i < readings.size(); ++i) {
+      SensorRecord& rec = records[i];
+      std::memset(&rec, 0, sizeof(rec));
+      readings[i].label.copy(rec.label, sizeof(rec.label) - 1);
+      rec.value = readings[i].value;
+      readings[i].chip.copy(rec.chip, sizeof(rec.chip) - 1);
+      std::strncpy(rec.type, readings[i].type, sizeof(rec.type) - 1);
+    }
+    return array;
+  }
+#endif
+  /**
+   * @brief Re-reads the temperatures.
+   * @param names Also rescan the chips (e.g. after loading a hwmon driver)
+   * and refresh the sensor names.
+   */
   void update(bool names = false) {
-    if (names)
-    sensors_names = GetAllSensorNames();
-    cputemp = GetCpuPackageTemp();
-    chipstemp = GetChipsetTemp();
-    mbtemp = GetMotherboardTemp();
-    memorytemp = GetVRMTemp();
-    storagetemp = GetDriveTemp();
+    if (names) {
+      session->reload();
+      sensors_names = session->labels();
+    }
+    read_temps();
   }
+  /**
+   * @brief The sensor backend in use: "libsensors" or "hwmon".
+   */
+  std::string get_backend() const { return session->backend(); }
 };
 #endif //__Linux__
 
@@ -1589,6 +3521,9 @@ PYBIND11_MODULE(LiveView, m) {
     .def(py::init<>())
     .def("get_usage", &PyLiveCPU::get_usage,
       "Returns total CPU usage percentage.", py::arg("interval_ms"))
+    .def("get_usage_delta", &PyLiveCPU::get_usage_delta,
+      "Returns (CPU usage %, elapsed ms) since the previous call without "
+      "sleeping.")
     .def("cpuid", &PyLiveCPU::cpuid,
       "Returns CPU information using CPUID instruction.")
     .def("cpu_id", &PyLiveCPU::cpuid,
@@ -1607,6 +3542,41 @@ PYBIND11_MODULE(LiveView, m) {
       py::arg("User") = true, py::arg("Idle") = true,
       py::arg("PureKernalTime") = false);
 #endif
+#ifdef __linux__
+  cpu_class
+    .def("get_per_core_usage", &PyLiveCPU::get_per_core_usage,
+      "Returns a flat list of [user, system, iowait, irq, softirq, steal] "
+      "percentages per core since the previous call.")
+    .def("get_usage_async", &PyLiveCPU::get_usage_async,
+      "Awaitable get_usage(): returns an asyncio future resolved on a shared "
+      "timer thread.", py::arg("interval_ms"));
+
+  // --- PyLiveCPUFreq Binding ---
+  py::class_<LiveView::CoreFrequency>(m, "CoreFrequency")
+    .def_readonly("cpu", &LiveView::CoreFrequency::cpu)
+    .def_readonly("cur_MHz", &LiveView::CoreFrequency::cur_MHz)
+    .def_readonly("min_MHz", &LiveView::CoreFrequency::min_MHz)
+    .def_readonly("max_MHz", &LiveView::CoreFrequency::max_MHz)
+    .def_readonly("effective_MHz", &LiveView::CoreFrequency::effective_MHz);
+
+  py::class_<PyLiveCPUFreq>(m, "PyLiveCPUFreq")
+    .def(py::init<>())
+    .def("get_frequencies", &PyLiveCPUFreq::get_frequencies,
+      "Returns the frequency of every online core; effective_MHz covers the "
+      "interval.", py::arg("interval") = 1000)
+    .def("get_frequencies_delta", &PyLiveCPUFreq::get_frequencies_delta,
+      "Returns (per-core frequencies, elapsed ms) since the previous call "
+      "without sleeping.")
+    .def("get_base_frequency", &PyLiveCPUFreq::get_base_frequency,
+      "Base frequency in MHz from CPUID leaf 0x16 (0 if not reported).")
+    .def("get_max_frequency", &PyLiveCPUFreq::get_max_frequency,
+      "Maximum frequency in MHz from CPUID leaf 0x16 (0 if not reported).")
+    .def("get_bus_frequency", &PyLiveCPUFreq::get_bus_frequency,
+      "Bus frequency in MHz from CPUID leaf 0x16 (0 if not reported).")
+    .def("has_effective_frequency", &PyLiveCPUFreq::has_effective_frequency,
+      "True if the APERF/MPERF counters could be read (root and the msr "
+      "module).");
+#endif
 
   // --- PyLiveRam Class Binding ---
   py::class_<PyLiveRam>(m, "PyLiveRam")
@@ -1615,12 +3585,16 @@ PYBIND11_MODULE(LiveView, m) {
       "Returns total RAM usage percentage.", py::arg("Raw") = false);
 
   // --- PyLiveDisk Class Binding ---
-  py::class_<PyLiveDisk>(m, "PyLiveDisk")
+  auto disk_class =
+    py::class_<PyLiveDisk>(m, "PyLiveDisk")
     .def(py::init<int>(),
       "mode=0 for % usage (Windows-only), mode=1 for R/W speed (MB/s).",
       py::arg("mode"))
     .def("get_usage", &PyLiveDisk::get_usage, "Returns disk usage info.",
       py::arg("interval") = 1000)
+    .def("get_usage_delta", &PyLiveDisk::get_usage_delta,
+      "Returns (disk usage info, elapsed ms) since the previous call without "
+      "sleeping.")
     .def("HighDiskUsage", &PyLiveDisk::HighDiskUsage,
       "Checks if R/W speed exceeds a threshold (MB/s).",
       py::arg("threshold_mbps") = 80.0)
@@ -1628,17 +3602,293 @@ PYBIND11_MODULE(LiveView, m) {
       "Checks if R/W speed exceeds a threshold (MB/s).",
       py::arg("threshold_mbps") = 80.0);
 
+#ifdef __linux__
+  // --- DiskDeviceStats Binding ---
+  py::class_<DiskDeviceStats>(m, "DiskDeviceStats")
+    .def_readonly("name", &DiskDeviceStats::name)
+    .def_readonly("read_iops", &DiskDeviceStats::read_iops)
+    .def_readonly("write_iops", &DiskDeviceStats::write_iops)
+    .def_readonly("read_merged_per_sec", &DiskDeviceStats::read_merged_per_sec)
+    .def_readonly("write_merged_per_sec",
+      &DiskDeviceStats::write_merged_per_sec)
+    .def_readonly("read_MBps", &DiskDeviceStats::read_MBps)
+    .def_readonly("write_MBps", &DiskDeviceStats::write_MBps)
+    .def_readonly("read_await_ms", &DiskDeviceStats::read_await_ms)
+    .def_readonly("write_await_ms", &DiskDeviceStats::write_await_ms)
+    .def_readonly("avg_queue_size", &DiskDeviceStats::avg_queue_size)
+    .def_readonly("in_flight", &DiskDeviceStats::in_flight)
+    .def_readonly("busy_percent", &DiskDeviceStats::busy_percent);
+
+  disk_class
+    .def("get_device_stats", &PyLiveDisk::get_device_stats,
+      "Returns per-device IOPS, await, queue size and % busy for every "
+      "whole disk.",
+      py::arg("interval") = 1000)
+    .def("get_device_stats_delta", &PyLiveDisk::get_device_stats_delta,
+      "Returns (per-device stats, elapsed ms) since the previous call "
+      "without sleeping.")
+    .def("get_usage_async", &PyLiveDisk::get_usage_async,
+      "Awaitable get_usage(): returns an asyncio future resolved on a shared "
+      "timer thread.", py::arg("interval") = 1000);
+#endif
+
   // --- PyLiveNetwork Class Binding ---
-  py::class_<PyLiveNetwork>(m, "PyLiveNetwork")
-    .def(py::init<>())
+  auto network_class =
+    py::class_<PyLiveNetwork>(m, "PyLiveNetwork")
+    .def(py::init<int>(),
+      "backend (Linux only): NET_BACKEND_AUTO, NET_BACKEND_NETLINK or "
+      "NET_BACKEND_PROCFS.",
+      py::arg("backend") = 0)
     .def("get_usage", &PyLiveNetwork::get_usage,
       "mode=0 for total MB/s, mode=1 for per-interface MB/s.",
       py::arg("interval") = 1000, py::arg("mode") = 0)
+    .def("get_usage_delta", &PyLiveNetwork::get_usage_delta,
+      "Returns (network usage, elapsed ms) since the previous call without "
+      "sleeping.",
+      py::arg("mode") = 0)
     .def("getHighCard", &PyLiveNetwork::getHighCard,
       "Returns the network interface with the highest usage.")
     .def("get_high_card", &PyLiveNetwork::getHighCard,
       "Returns the network interface with the highest usage.");
 
+#ifdef __linux__
+  // --- NetInterfaceStats Binding ---
+  py::class_<NetInterfaceStats>(m, "NetInterfaceStats")
+    .def_readonly("name", &NetInterfaceStats::name)
+    .def_readonly("rx_MBps", &NetInterfaceStats::rx_MBps)
+    .def_readonly("tx_MBps", &NetInterfaceStats::tx_MBps)
+    .def_readonly("rx_packets", &NetInterfaceStats::rx_packets)
+    .def_readonly("tx_packets", &NetInterfaceStats::tx_packets)
+    .def_readonly("rx_errors", &NetInterfaceStats::rx_errors)
+    .def_readonly("tx_errors", &NetInterfaceStats::tx_errors)
+    .def_readonly("rx_drops", &NetInterfaceStats::rx_drops)
+    .def_readonly("tx_drops", &NetInterfaceStats::tx_drops);
+
+  network_class
+    .def("get_interface_stats", &PyLiveNetwork::get_interface_stats,
+      "Returns rx/tx bytes, packets, errors and drops per second for every "
+      "interface.",
+      py::arg("interval") = 1000)
+    .def("get_interface_stats_delta", &PyLiveNetwork::get_interface_stats_delta,
+      "Returns (per-interface stats, elapsed ms) since the previous call "
+      "without sleeping.")
+    .def("get_backend", &PyLiveNetwork::get_backend,
+      "Returns the counter backend in use: 'netlink' or 'procfs'.")
+    .def("get_usage_async", &PyLiveNetwork::get_usage_async,
+      "Awaitable get_usage(): returns an asyncio future resolved on a shared "
+      "timer thread.", py::arg("interval") = 1000, py::arg("mode") = 0);
+
+  m.attr("NET_BACKEND_AUTO") = static_cast<int>(LiveView::NET_BACKEND_AUTO);
+  m.attr("NET_BACKEND_NETLINK") =
+    static_cast<int>(LiveView::NET_BACKEND_NETLINK);
+  m.attr("NET_BACKEND_PROCFS") = static_cast<int>(LiveView::NET_BACKEND_PROCFS);
+
+  // --- PyLivePressure Binding ---
+  py::class_<LiveView::PressureLine>(m, "PressureLine")
+    .def_readonly("avg10", &LiveView::PressureLine::avg10)
+    .def_readonly("avg60", &LiveView::PressureLine::avg60)
+    .def_readonly("avg300", &LiveView::PressureLine::avg300)
+    .def_readonly("total_us", &LiveView::PressureLine::total_us);
+
+  py::class_<LiveView::PressureStats>(m, "PressureStats")
+    .def_readonly("resource", &LiveView::PressureStats::resource)
+    .def_readonly("some", &LiveView::PressureStats::some)
+    .def_readonly("full", &LiveView::PressureStats::full)
+    .def_readonly("has_full", &LiveView::PressureStats::has_full);
+
+  py::class_<PyLivePressure>(m, "PyLivePressure")
+    .def(py::init<const std::string&>(), py::arg("cgroup") = "",
+      "cgroup='' for the whole system, else a cgroup v2 directory.")
+    .def("get_pressure", &PyLivePressure::get_pressure, py::arg("resource"),
+      "Returns the PSI averages and total stall time of 'cpu', 'memory', "
+      "'io' or 'irq'.")
+    .def("get_all", &PyLivePressure::get_all,
+      "Returns the pressure of every available resource.")
+    .def("add_trigger", &PyLivePressure::add_trigger, py::arg("resource"),
+      py::arg("stall_us"), py::arg("window_us") = 2000000,
+      py::arg("kind") = "some",
+      "Registers a PSI trigger (stall_us of stall within window_us); "
+      "returns its id.")
+    .def("remove_trigger", &PyLivePressure::remove_trigger, py::arg("id"))
+    .def("trigger_count", &PyLivePressure::trigger_count)
+    .def("wait", &PyLivePressure::wait, py::arg("timeout_ms") = -1,
+      "Sleeps until triggers fire; returns their ids (empty on timeout).")
+    .def("interrupt", &PyLivePressure::interrupt,
+      "Makes a running wait() return.")
+    .def("get_cgroup", &PyLivePressure::get_cgroup);
+#endif
+
+  // --- LiveSample Binding ---
+  py::class_<LiveSample>(m, "LiveSample")
+    .def(py::init<>())
+    .def_readonly("timestamp_ns", &LiveSample::timestamp_ns)
+    .def_readonly("wall_time_ns", &LiveSample::wall_time_ns)
+    .def_readonly("interval_ms", &LiveSample::interval_ms)
+    .def_readonly("cpu_usage", &LiveSample::cpu_usage)
+    .def_readonly("ram_usage", &LiveSample::ram_usage)
+    .def_readonly("ram_used_bytes", &LiveSample::ram_used_bytes)
+    .def_readonly("ram_total_bytes", &LiveSample::ram_total_bytes)
+    .def_readonly("disk_read_MBps", &LiveSample::disk_read_MBps)
+    .def_readonly("disk_write_MBps", &LiveSample::disk_write_MBps)
+    .def_readonly("net_MBps", &LiveSample::net_MBps);
+
+  // --- PySamplerService Binding ---
+  auto sampler_class = py::class_<PySamplerService>(m, "PySamplerService")
+    .def(py::init<int, size_t>(), py::arg("interval_ms") = 1000,
+      py::arg("capacity") = 3600)
+    .def("start", &PySamplerService::start,
+      "Starts the background sampling thread.")
+    .def("stop", &PySamplerService::stop,
+      "Stops the background sampling thread.")
+    .def("is_running", &PySamplerService::is_running)
+    .def("latest", &PySamplerService::latest,
+      "Returns the most recent LiveSample, or None if none was collected yet.")
+    .def("history", &PySamplerService::history, py::arg("count") = 0,
+      "Returns up to `count` recent samples, oldest first (0 = all).")
+    .def("history_array", &PySamplerService::history_array,
+      py::arg("count") = 0,
+      "Same as history(), as a NumPy structured array (one field per "
+      "LiveSample attribute).")
+    .def("history_columns", &PySamplerService::history_columns,
+      py::arg("count") = 0,
+      "Same as history(), as a dict of NumPy arrays, one per attribute, plus "
+      "(Linux only) 2-D per-core and per-device arrays; all are views of one "
+      "buffer.")
+    .def("set_interval", &PySamplerService::set_interval, py::arg("ms"))
+    .def("get_interval", &PySamplerService::get_interval)
+    .def("sample_count", &PySamplerService::sample_count,
+      "Total number of samples collected.")
+    .def("capacity", &PySamplerService::capacity,
+      "Number of samples kept in the history ring.")
+    .def("get_error_count", &PySamplerService::get_error_count,
+      "Number of collection passes that failed.");
+#ifdef __linux__
+  sampler_class
+    .def("start_recording", &PySamplerService::start_recording,
+      py::arg("path"), py::arg("sensors") = false,
+      "(Linux only) Appends the raw counters of every pass to a recording "
+      "file; sensors=True also records every sensor value.")
+    .def("stop_recording", &PySamplerService::stop_recording,
+      "(Linux only) Stops recording and closes the file.")
+    .def("is_recording", &PySamplerService::is_recording,
+      "(Linux only) True while recording.")
+    .def("start_publishing", &PySamplerService::start_publishing,
+      py::arg("name") = LiveView::SHARED_METRICS_DEFAULT_NAME,
+      "(Linux only) Publishes every sample into the shared-memory segment "
+      "/dev/shm/<name> for PySharedMetricsReader.")
+    .def("stop_publishing", &PySamplerService::stop_publishing,
+      "(Linux only) Stops publishing and removes the segment.")
+    .def("is_publishing", &PySamplerService::is_publishing,
+      "(Linux only) True while publishing.")
+    .def("history_layout", &PySamplerService::history_layout,
+      "(Linux only) Core numbers, disk and interface names of the columns of "
+      "the 2-D history_columns() arrays, fixed by the first start().");
+
+  // --- PyLiveReplay Binding ---
+  py::class_<PyLiveReplay>(m, "PyLiveReplay")
+    .def(py::init<const std::string&>(), py::arg("path"),
+      "Opens a recording made by PySamplerService.start_recording().")
+    .def("next", &PyLiveReplay::next,
+      "Returns the next LiveSample, or None at the end of the recording.")
+    .def("read", &PyLiveReplay::read, py::arg("count") = 0,
+      "Replays up to `count` samples as fast as possible (0 = all).")
+    .def("play", &PyLiveReplay::play, py::arg("callback"),
+      py::arg("speed") = 1.0,
+      "Calls callback(sample) for every remaining sample at the recorded "
+      "cadence divided by speed (<= 0: as fast as possible). Returns the "
+      "number of samples.")
+    .def("get_sensors", &PyLiveReplay::get_sensors,
+      "Sensors of the current frame as (label, value, chip, type) tuples.")
+    .def("rewind", &PyLiveReplay::rewind,
+      "Starts over from the first frame.")
+    .def("frame_count", &PyLiveReplay::frame_count,
+      "Number of frames read so far.");
+
+  // --- PyMetricsExporter Binding ---
+  py::class_<PyMetricsExporter>(m, "PyMetricsExporter")
+    .def(py::init<const PySamplerService&, const std::string&, int,
+      const std::map<std::string, std::string>&>(),
+      py::arg("sampler"), py::arg("address") = "127.0.0.1",
+      py::arg("port") = 9101,
+      py::arg("labels") = std::map<std::string, std::string>{},
+      py::keep_alive<1, 2>(),
+      "Serves the sampler's latest values on http://address:port/metrics; "
+      "labels are added to every series.")
+    .def("start", &PyMetricsExporter::start,
+      "Binds the address and starts serving /metrics.")
+    .def("stop", &PyMetricsExporter::stop, "Stops serving.")
+    .def("is_running", &PyMetricsExporter::is_running)
+    .def("get_port", &PyMetricsExporter::get_port,
+      "The port being served (0 while stopped).")
+    .def("get_address", &PyMetricsExporter::get_address)
+    .def("scrape_count", &PyMetricsExporter::scrape_count,
+      "Number of /metrics requests answered.");
+
+  // --- PySharedMetricsReader Binding ---
+  py::class_<PySharedMetricsReader>(m, "PySharedMetricsReader")
+    .def(py::init<const std::string&>(),
+      py::arg("name") = LiveView::SHARED_METRICS_DEFAULT_NAME,
+      "Maps the segment published under `name`.")
+    .def("read", &PySharedMetricsReader::read,
+      "Returns the latest published LiveSample, or None if none yet.")
+    .def("sample_count", &PySharedMetricsReader::sample_count,
+      "Samples collected by the publisher.")
+    .def("get_error_count", &PySharedMetricsReader::get_error_count,
+      "Failed collection passes of the publisher.")
+    .def("publisher_pid", &PySharedMetricsReader::publisher_pid,
+      "Pid of the publisher, 0 once it stopped.")
+    .def("publisher_alive", &PySharedMetricsReader::publisher_alive,
+      "Whether the publishing process is still running.")
+    .def("get_name", &PySharedMetricsReader::get_name);
+#endif
+
+  // --- SnapshotResult Binding ---
+  py::class_<SnapshotResult>(m, "SnapshotResult")
+    .def(py::init<>())
+    .def_readonly("interval_ms", &SnapshotResult::interval_ms)
+    .def_readonly("cpu_usage", &SnapshotResult::cpu_usage)
+    .def_readonly("ram_usage", &SnapshotResult::ram_usage)
+    .def_readonly("ram_used_bytes", &SnapshotResult::ram_used_bytes)
+    .def_readonly("ram_total_bytes", &SnapshotResult::ram_total_bytes)
+    .def_readonly("disk_read_MBps", &SnapshotResult::disk_read_MBps)
+    .def_readonly("disk_write_MBps", &SnapshotResult::disk_write_MBps)
+    .def_readonly("net_MBps", &SnapshotResult::net_MBps)
+    .def_readonly("net_interfaces", &SnapshotResult::net_interfaces);
+
+  // --- PyLiveSnapshot Binding ---
+  m.attr("SNAPSHOT_CPU") = SNAPSHOT_CPU;
+  m.attr("SNAPSHOT_RAM") = SNAPSHOT_RAM;
+  m.attr("SNAPSHOT_DISK") = SNAPSHOT_DISK;
+  m.attr("SNAPSHOT_NETWORK") = SNAPSHOT_NETWORK;
+  m.attr("SNAPSHOT_ALL") = SNAPSHOT_ALL;
+  py::class_<PyLiveSnapshot>(m, "PyLiveSnapshot")
+    .def(py::init<int>(), py::arg("subsystems") = SNAPSHOT_ALL,
+      "subsystems is a bitmask of SNAPSHOT_CPU, SNAPSHOT_RAM, SNAPSHOT_DISK "
+      "and SNAPSHOT_NETWORK.")
+    .def("take", &PyLiveSnapshot::take, py::arg("interval_ms") = 1000,
+      "Measures all selected subsystems over one shared interval.");
+
+  // --- Collector Cost Accounting ---
+  py::class_<LiveView::CollectorStats>(m, "CollectorStats")
+    .def_readonly("name", &LiveView::CollectorStats::name)
+    .def_readonly("calls", &LiveView::CollectorStats::calls)
+    .def_readonly("errors", &LiveView::CollectorStats::errors)
+    .def_readonly("syscalls", &LiveView::CollectorStats::syscalls)
+    .def_readonly("bytes_read", &LiveView::CollectorStats::bytes_read)
+    .def_readonly("total_ns", &LiveView::CollectorStats::total_ns)
+    .def_readonly("io_ns", &LiveView::CollectorStats::io_ns)
+    .def_readonly("parse_ns", &LiveView::CollectorStats::parse_ns)
+    .def_readonly("max_ns", &LiveView::CollectorStats::max_ns)
+    .def_readonly("p50_ns", &LiveView::CollectorStats::p50_ns)
+    .def_readonly("p90_ns", &LiveView::CollectorStats::p90_ns)
+    .def_readonly("p99_ns", &LiveView::CollectorStats::p99_ns)
+    .def_readonly("histogram", &LiveView::CollectorStats::histogram);
+  m.def("get_collector_stats", &LiveView::get_collector_stats,
+    "Returns the calls, errors, syscalls, bytes read, I/O and parse time and "
+    "latency histogram of every collector since the last reset.");
+  m.def("reset_collector_stats", &LiveView::reset_collector_stats,
+    "Zeroes the counters of every collector.");
+
 #ifdef _WIN32
   // --- PyLiveGpu Binding ---
   py::class_<PyLiveGpu>(m, "PyLiveGpu")
@@ -1774,7 +4024,11 @@ py::class_<PyHPCMISensor>(m, "PyHPCMISensor")
 #ifdef __linux__
   // --- PyLinuxSensor Binding ---
   py::class_<PyLinuxSensor>(m, "PyLinuxSensor")
-    .def(py::init<>())
+    .def(py::init<int>(),
+      "backend: SENSOR_BACKEND_AUTO (libsensors, or the hwmon sysfs reader "
+      "if libsensors is unavailable), SENSOR_BACKEND_LIBSENSORS or "
+      "SENSOR_BACKEND_HWMON.",
+      py::arg("backend") = 0)
     .def("getCpuTemp", &PyLinuxSensor::getCpuTemp, "Get CPU temperature")
     .def("get_cpu_temp", &PyLinuxSensor::getCpuTemp, "Get CPU temperature")
     .def("getChipsetTemp", &PyLinuxSensor::getChipsetTemp,
@@ -1811,8 +4065,43 @@ py::class_<PyHPCMISensor>(m, "PyHPCMISensor")
       "Get all sensors with their temperature values")
     .def("get_sensors_with_temp", &PyLinuxSensor::GetSensorsWithTemp,
       "Get all sensors with their temperature values")
+    .def("get_all_sensors", &PyLinuxSensor::get_all_sensors,
+      "Returns every sensor as (label, value, chip, type), read in one pass.")
+    .def("get_all_sensors_array", &PyLinuxSensor::get_all_sensors_array,
+      "Returns every sensor as a NumPy structured array with the fields "
+      "label, value, chip and type.")
     .def("update", &PyLinuxSensor::update, py::arg("names") = false,
-      "Update sensor data, optionally update names");
+      "Update sensor data, optionally update names")
+    .def("get_backend", &PyLinuxSensor::get_backend,
+      "Returns the sensor backend in use: 'libsensors' or 'hwmon'.");
+
+  m.attr("SENSOR_BACKEND_AUTO") =
+    static_cast<int>(LiveView::SENSOR_BACKEND_AUTO);
+  m.attr("SENSOR_BACKEND_LIBSENSORS") =
+    static_cast<int>(LiveView::SENSOR_BACKEND_LIBSENSORS);
+  m.attr("SENSOR_BACKEND_HWMON") =
+    static_cast<int>(LiveView::SENSOR_BACKEND_HWMON);
+
+  // --- Sysroot ---
+  m.def("set_sys_root", [](const std::string& root) {
+      LiveView::set_sys_root(root);
+      // The legacy C functions (HardView.HardView) keep their own sysroot
+      py::module_ legacy;
+      try {
+        legacy = py::module_::import("HardView.HardView");
+      } catch (py::error_already_set& e) {
+        if (!e.matches(PyExc_ImportError))
+          throw;
+        return; // LiveView used without the HardView package
+      }
+      if (py::hasattr(legacy, "set_sys_root"))
+        legacy.attr("set_sys_root")(root);
+    }, py::arg("root"),
+    "Reads every /proc and /sys file under root instead of / (e.g. a tree "
+    "captured with Tools/SysCapture), for LiveView and the legacy HardView "
+    "functions. '' reads the live system again.");
+  m.def("get_sys_root", &LiveView::get_sys_root,
+    "Returns the current sysroot, '' for the live system.");
 #endif
 }
 #endif
@@ -0,0 +1,308 @@
+/*
+================================================================================
+ MIT License
+
+ Copyright (c) 2025 gafoo
+
+ This file is part of the HardView project:
+ https://github.com/gafoo173/HardView
+
+ Licensed under the MIT License.
+ See the LICENSE file in the project root for more details.
+================================================================================
+*/
+// ===================================================================================
+// CollectorStats.hpp: Cost accounting for the LiveView collectors.
+//
+// Every collector (CPU, RAM, disk, network, sensors, cpuid, cpufreq,
+// pressure) wraps one sample in a CollectorTimer. The timer records the wall
+// time of the sample into per-collector counters and a log-linear latency
+// histogram, together with the syscalls and bytes read on the calling thread
+// while it was running (counted by the I/O helpers through io_counters()).
+// Everything is lock-free and costs two clock reads per sample plus two per
+// syscall.
+// ===================================================================================
+#ifndef COLLECTOR_STATS_HPP
+#define COLLECTOR_STATS_HPP
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace LiveView {
+
+/**
+ * @brief The instrumented collectors.
+ */
+enum Collector : int {
+  COLLECTOR_CPU = 0,
+  COLLECTOR_RAM,
+  COLLECTOR_DISK,
+  COLLECTOR_NETWORK,
+  COLLECTOR_SENSORS,
+  COLLECTOR_CPUID,
+  COLLECTOR_CPU_FREQ,
+  COLLECTOR_PRESSURE,
+  COLLECTOR_COUNT
+};
+
+inline const char *collector_name(int collector) {
+  static const char *const names[COLLECTOR_COUNT] = {
+      "cpu",     "ram",   "disk",    "network",
+      "sensors", "cpuid", "cpufreq", "pressure"};
+  return collector >= 0 && collector < COLLECTOR_COUNT ? names[collector]
+                                                       : "unknown";
+}
+
+inline uint64_t monotonic_ns() {
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now().time_since_epoch())
+          .count());
+}
+
+/**
+ * @brief Per-thread I/O totals, advanced by the procfs/sysfs/netlink helpers.
+ */
+struct IoCounters {
+  uint64_t syscalls = 0;
+  uint64_t bytes = 0;
+  uint64_t ns = 0; // Time spent inside those syscalls
+};
+
+inline IoCounters &io_counters() {
+  static thread_local IoCounters counters;
+  return counters;
+}
+
+/**
+ * @brief Accounts one syscall made by an I/O helper.
+ * @param start monotonic_ns() taken just before the call.
+ * @param bytes Bytes transferred (0 for open, close, send...).
+ */
+inline void count_syscall(uint64_t start, uint64_t bytes = 0) {
+  IoCounters &io = io_counters();
+  ++io.syscalls;
+  io.bytes += bytes;
+  io.ns += monotonic_ns() - start;
+}
+
+/**
+ * @brief Log-linear latency histogram: every power of two of nanoseconds is
+ * split into 4 linear sub-buckets (at most 25% relative error). Values below
+ * 256 ns share bucket 0 and values above ~68 s share the last bucket.
+ */
+class LatencyHistogram {
+public:
+  static constexpr int SUB_BITS = 2;
+  static constexpr int MIN_EXP = 8;  // 256 ns
+  static constexpr int MAX_EXP = 36; // ~68.7 s
+  static constexpr int BUCKETS = (MAX_EXP - MIN_EXP) * (1 << SUB_BITS) + 1;
+
+  static int bucket_of(uint64_t ns) {
+    if (ns < (uint64_t(1) << MIN_EXP))
+      return 0;
+    int exp = 63 - count_leading_zeros(ns);
+    if (exp >= MAX_EXP)
+      return BUCKETS - 1;
+    int sub =
+        static_cast<int>((ns >> (exp - SUB_BITS)) & ((1 << SUB_BITS) - 1));
+    return 1 + (exp - MIN_EXP) * (1 << SUB_BITS) + sub;
+  }
+
+  /**
+   * @brief Exclusive upper bound of a bucket in nanoseconds.
+   */
+  static uint64_t upper_bound(int bucket) {
+    if (bucket <= 0)
+      return uint64_t(1) << MIN_EXP;
+    if (bucket >= BUCKETS - 1)
+      return UINT64_MAX;
+    int exp = MIN_EXP + (bucket - 1) / (1 << SUB_BITS);
+    uint64_t sub = static_cast<uint64_t>((bucket - 1) % (1 << SUB_BITS)) + 1;
+    return (uint64_t(1) << exp) + (sub << (exp - SUB_BITS));
+  }
+
+  void record(uint64_t ns) {
+    counts[bucket_of(ns)].fetch_add(1, std::memory_order_relaxed);
+  }
+
+  uint64_t count(int bucket) const {
+    return counts[bucket].load(std::memory_order_relaxed);
+  }
+
+  void reset() {
+    for (auto &c : counts)
+      c.store(0, std::memory_order_relaxed);
+  }
+
+private:
+  std::atomic<uint64_t> counts[BUCKETS] = {};
+
+  static int count_leading_zeros(uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_clzll(value);
+#else
+    int n = 0;
+    for (uint64_t bit = uint64_t(1) << 63; !(value & bit); bit >>= 1)
+      ++n;
+    return n;
+#endif
+  }
+};
+
+/**
+ * @brief Counters of one collector.
+ */
+struct CollectorCounters {
+  std::atomic<uint64_t> calls{0};
+  std::atomic<uint64_t> errors{0}; // Samples that ended with an exception
+  std::atomic<uint64_t> syscalls{0};
+  std::atomic<uint64_t> bytes_read{0};
+  std::atomic<uint64_t> total_ns{0};
+  std::atomic<uint64_t> io_ns{0};
+  std::atomic<uint64_t> max_ns{0};
+  LatencyHistogram histogram;
+};
+
+inline CollectorCounters *collector_counters() {
+  static CollectorCounters table[COLLECTOR_COUNT];
+  return table;
+}
+
+/**
+ * @brief Point-in-time copy of a collector's counters.
+ */
+struct CollectorStats {
+  std::string name;
+  uint64_t calls;      // Samples taken
+  uint64_t errors;     // Samples that failed
+  uint64_t syscalls;   // Syscalls made by LiveView's own I/O helpers
+  uint64_t bytes_read; // Bytes read by those syscalls
+  uint64_t total_ns;   // Wall time of all samples
+  uint64_t io_ns;      // Part of total_ns spent in those syscalls
+  uint64_t parse_ns;   // total_ns - io_ns: parsing and computation
+  uint64_t max_ns;     // Slowest sample
+  uint64_t p50_ns;     // Latency percentiles (bucket upper bounds)
+  uint64_t p90_ns;
+  uint64_t p99_ns;
+  // Non-empty histogram buckets as (upper bound in ns, count)
+  std::vector<std::pair<uint64_t, uint64_t>> histogram;
+};
+
+/**
+ * @class CollectorTimer
+ * @brief Times one sample of a collector (RAII). Samples must not nest on
+ * the same thread, or the inner sample's I/O is counted twice.
+ */
+class CollectorTimer {
+public:
+  explicit CollectorTimer(int collector)
+      : counters(collector_counters()[collector]), io(io_counters()),
+        startIo(io), exceptions(std::uncaught_exceptions()),
+        start(monotonic_ns()) {}
+
+  ~CollectorTimer() {
+    uint64_t ns = monotonic_ns() - start;
+    counters.calls.fetch_add(1, std::memory_order_relaxed);
+    if (std::uncaught_exceptions() > exceptions)
+      counters.errors.fetch_add(1, std::memory_order_relaxed);
+    counters.syscalls.fetch_add(io.syscalls - startIo.syscalls,
+                                std::memory_order_relaxed);
+    counters.bytes_read.fetch_add(io.bytes - startIo.bytes,
+                                  std::memory_order_relaxed);
+    counters.io_ns.fetch_add(io.ns - startIo.ns, std::memory_order_relaxed);
+    counters.total_ns.fetch_add(ns, std::memory_order_relaxed);
+    uint64_t slowest = counters.max_ns.load(std::memory_order_relaxed);
+    while (ns > slowest && !counters.max_ns.compare_exchange_weak(
+                               slowest, ns, std::memory_order_relaxed)) {
+    }
+    counters.histogram.record(ns);
+  }
+
+  CollectorTimer(const CollectorTimer &) = delete;
+  CollectorTimer &operator=(const CollectorTimer &) = delete;
+
+private:
+  CollectorCounters &counters;
+  IoCounters &io;
+  IoCounters startIo;
+  int exceptions;
+  uint64_t start;
+};
+
+/**
+ * @brief Snapshot of the counters of every collector.
+ */
+inline std::vector<CollectorStats> get_collector_stats() {
+  std::vector<CollectorStats> result;
+  result.reserve(COLLECTOR_COUNT);
+  for (int c = 0; c < COLLECTOR_COUNT; ++c) {
+    const CollectorCounters &k = collector_counters()[c];
+    CollectorStats s;
+    s.name = collector_name(c);
+    s.calls = k.calls.load(std::memory_order_relaxed);
+    s.errors = k.errors.load(std::memory_order_relaxed);
+    s.syscalls = k.syscalls.load(std::memory_order_relaxed);
+    s.bytes_read = k.bytes_read.load(std::memory_order_relaxed);
+    s.total_ns = k.total_ns.load(std::memory_order_relaxed);
+    s.io_ns = k.io_ns.load(std::memory_order_relaxed);
+    s.parse_ns = s.total_ns > s.io_ns ? s.total_ns - s.io_ns : 0;
+    s.max_ns = k.max_ns.load(std::memory_order_relaxed);
+
+    uint64_t counts[LatencyHistogram::BUCKETS];
+    uint64_t samples = 0;
+    for (int b = 0; b < LatencyHistogram::BUCKETS; ++b) {
+      counts[b] = k.histogram.count(b);
+      samples += counts[b];
+      if (counts[b])
+        s.histogram.emplace_back(LatencyHistogram::upper_bound(b), counts[b]);
+    }
+    // Percentiles from the same histogram copy, so they are consistent.
+    uint64_t *targets[] = {&s.p50_ns, &s.p90_ns, &s.p99_ns};
+    const double quantiles[] = {0.50, 0.90, 0.99};
+    for (int q = 0; q < 3; ++q) {
+      *targets[q] = 0;
+      if (samples == 0)
+        continue;
+      uint64_t rank = static_cast<uint64_t>(quantiles[q] * samples);
+      uint64_t seen = 0;
+      for (int b = 0; b < LatencyHistogram::BUCKETS; ++b) {
+        seen += counts[b];
+        if (seen > rank) {
+          uint64_t bound = LatencyHistogram::upper_bound(b);
+          *targets[q] = bound < s.max_ns ? bound : s.max_ns;
+          break;
+        }
+      }
+    }
+    result.push_back(std::move(s));
+  }
+  return result;
+}
+
+/**
+ * @brief Zeroes the counters of every collector.
+ */
+inline void reset_collector_stats() {
+  for (int c = 0; c < COLLECTOR_COUNT; ++c) {
+    CollectorCounters &k = collector_counters()[c];
+    k.calls.store(0, std::memory_order_relaxed);
+    k.errors.store(0, std::memory_order_relaxed);
+    k.syscalls.store(0, std::memory_order_relaxed);
+    k.bytes_read.store(0, std::memory_order_relaxed);
+    k.total_ns.store(0, std::memory_order_relaxed);
+    k.io_ns.store(0, std::memory_order_relaxed);
+    k.max_ns.store(0, std::memory_order_relaxed);
+    k.histogram.reset();
+  }
+}
+
+} // namespace LiveView
+
+#endif // COLLECTOR_STATS_HPP
@@ -0,0 +1,340 @@
+/*
+================================================================================
+ MIT License
+
+ Copyright (c) 2025 gafoo
+
+ This file is part of the HardView project:
+ https://github.com/gafoo173/HardView
+
+ Licensed under the MIT License.
+ See the LICENSE file in the project root for more details.
+================================================================================
+*/
+// ===================================================================================
+// CpuFreq.hpp: Per-core clock speed of every online CPU (Linux).
+//
+// One sweep reads scaling_cur_freq of every online core through a descriptor
+// kept open between sweeps, and the policy limits through the bounded
+// ProcFileCache, so a reader holds at most two descriptors per core (with
+// the MSR one) on hosts with hundreds of threads. Without cpufreq (most
+// virtual machines) the "cpu MHz" lines of /proc/cpuinfo are used instead.
+//
+// Where /dev/cpu/N/msr is readable (root and the msr module), the sweep also
+// reads the APERF and MPERF counters. MPERF counts at the nominal (base)
+// frequency and APERF at the actual one, both only while the core is not
+// halted, so base * dAPERF / dMPERF is the average clock the core really
+// ran at since the previous sweep: it shows turbo and throttling, which the
+// cpufreq value (a request, or an estimate of its own) can hide. The base
+// frequency comes from the caller (CPUID leaf 0x16); when it is unknown the
+// TSC rate, which runs at the nominal frequency, is measured instead.
+// ===================================================================================
+#ifndef CPU_FREQ_HPP
+#define CPU_FREQ_HPP
+#pragma once
+
+#ifdef __linux__
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "ProcReader.hpp"
+
+namespace LiveView {
+
+constexpr uint32_t MSR_IA32_MPERF = 0xE7;
+constexpr uint32_t MSR_IA32_APERF = 0xE8;
+
+/**
+ * @struct CoreFrequency
+ * @brief Clock speed of one core. Values that cannot be read are -1.
+ */
+struct CoreFrequency {
+  int cpu = 0;               // Logical CPU number
+  double cur_MHz = -1;       // scaling_cur_freq, or "cpu MHz" of /proc/cpuinfo
+  double min_MHz = -1;       // scaling_min_freq: lower policy limit
+  double max_MHz = -1;       // scaling_max_freq: lowered by power/thermal caps
+  double effective_MHz = -1; // From APERF/MPERF since the previous sweep
+};
+
+/**
+ * @brief Parses a CPU list such as "0-3,8,10-11" (the format of
+ * /sys/devices/system/cpu/online).
+ */
+inline void parse_cpu_list(const std::string &text, std::vector<int> &cpus) {
+  cpus.clear();
+  const char *p = text.data();
+  const char *end = p + text.size();
+  while (p < end) {
+    if (*p < '0' || *p > '9') {
+      ++p;
+      continue;
+    }
+    long long first = scan_ll(p, end);
+    long long last = first;
+    if (p < end && *p == '-') {
+      ++p;
+      last = scan_ll(p, end);
+    }
+    for (long long cpu = first; cpu <= last && cpu < 65536; ++cpu)
+      cpus.push_back(static_cast<int>(cpu));
+  }
+}
+
+/**
+ * @class CpuFreqReader
+ * @brief Sweeps the frequency of every online core. The set of cores and
+ * their descriptors are rebuilt when the online mask or the sysroot changes.
+ * All methods are thread-safe.
+ */
+class CpuFreqReader {
+public:
+  /**
+   * @param baseMHz Nominal frequency (MPERF rate) in MHz, e.g. CPUID leaf
+   * 0x16; 0 to measure the TSC rate instead.
+   */
+  explicit CpuFreqReader(double baseMHz = 0) : baseMHz(baseMHz) {}
+
+  ~CpuFreqReader() { close_cores(); }
+
+  CpuFreqReader(const CpuFreqReader &) = delete;
+  CpuFreqReader &operator=(const CpuFreqReader &) = delete;
+
+  /**
+   * @brief Reads the frequency of every online core in one sweep.
+   * effective_MHz covers the time since the previous sweep, so it is -1 on
+   * the first one, for cores that just came online and without MSR access.
+   * @param out One entry per online core, in CPU order.
+   * @return Seconds since the previous sweep (0 on the first one).
+   */
+  double read(std::vector<CoreFrequency> &out) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!read_proc_file("/sys/devices/system/cpu/online", buffer))
+      buffer.assign("0"); // Very old kernels: assume a single CPU
+    uint64_t root = sys_root_generation();
+    if (buffer != onlineMask || root != rootGeneration) {
+      open_cores(buffer);
+      rootGeneration = root;
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    double elapsed = hasPrev
+                         ? std::chrono::duration<double>(now - prevTime).count()
+                         : 0.0;
+    double nominalHz = baseMHz * 1e6;
+#if defined(__x86_64__) || defined(__i386__)
+    uint64_t tsc = __rdtsc();
+    if (nominalHz <= 0 && elapsed > 0)
+      nominalHz = static_cast<double>(tsc - prevTsc) / elapsed;
+    prevTsc = tsc;
+#endif
+    prevTime = now;
+    hasPrev = true;
+
+    bool cpuinfoRead = false;
+    out.resize(cores.size());
+    for (size_t i = 0; i < cores.size(); ++i) {
+      Core &core = cores[i];
+      CoreFrequency &f = out[i];
+      f = CoreFrequency();
+      f.cpu = core.cpu;
+      f.cur_MHz = read_kHz(core.curFd);
+      f.min_MHz = read_kHz(core.minPath);
+      f.max_MHz = read_kHz(core.maxPath);
+      if (f.cur_MHz < 0) {
+        if (!cpuinfoRead) {
+          read_cpuinfo_MHz();
+          cpuinfoRead = true;
+        }
+        if (static_cast<size_t>(core.cpu) < cpuinfoMHz.size())
+          f.cur_MHz = cpuinfoMHz[core.cpu];
+      }
+
+      uint64_t aperf, mperf;
+      if (core.msrFd >= 0 && read_msr(core.msrFd, MSR_IA32_APERF, aperf) &&
+          read_msr(core.msrFd, MSR_IA32_MPERF, mperf)) {
+        // The counters are reset on resume from suspend: skip that sweep
+        if (core.hasCounters && mperf > core.mperf && aperf >= core.aperf &&
+            nominalHz > 0)
+          f.effective_MHz = nominalHz / 1e6 *
+                            static_cast<double>(aperf - core.aperf) /
+                            static_cast<double>(mperf - core.mperf);
+        core.aperf = aperf;
+        core.mperf = mperf;
+        core.hasCounters = true;
+      } else {
+        core.hasCounters = false;
+      }
+    }
+    return elapsed;
+  }
+
+  /**
+   * @brief True if the APERF/MPERF counters of at least one core could be
+   * opened by the last sweep.
+   */
+  bool msr_available() {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const Core &core : cores) {
+      if (core.msrFd >= 0)
+        return true;
+    }
+    return false;
+  }
+
+  /**
+   * @brief The nominal frequency given to the constructor (0: measured).
+   */
+  double get_base_MHz() const { return baseMHz; }
+
+private:
+  struct Core {
+    int cpu;
+    int curFd = -1;
+    int msrFd = -1;
+    std::string minPath; // Read through read_proc_file()
+    std::string maxPath;
+    uint64_t aperf = 0;
+    uint64_t mperf = 0;
+    bool hasCounters = false;
+  };
+
+  std::vector<Core> cores;
+  std::vector<int> cpus;
+  std::vector<double> cpuinfoMHz; // Indexed by CPU number
+  std::string onlineMask;
+  std::string buffer;
+  std::string path;
+  double baseMHz;
+  uint64_t rootGeneration = 0;
+  uint64_t prevTsc = 0;
+  std::chrono::steady_clock::time_point prevTime;
+  bool hasPrev = false;
+  std::mutex mutex;
+
+  static int open_counted(const char *file) {
+    uint64_t start = monotonic_ns();
+    int fd = ::open(file, O_RDONLY | O_CLOEXEC);
+    count_syscall(start);
+    return fd;
+  }
+
+  static std::string cpufreq_file(int cpu, const char *name) {
+    return "/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/cpufreq/" +
+           name;
+  }
+
+  int open_sys(int cpu, const char *name) {
+    return open_counted(sys_path(cpufreq_file(cpu, name).c_str(), path));
+  }
+
+  void open_cores(const std::string &mask) {
+    close_cores();
+    onlineMask = mask;
+    parse_cpu_list(mask, cpus);
+    cores.reserve(cpus.size());
+    for (int cpu : cpus) {
+      Core core;
+      core.cpu = cpu;
+      core.curFd = open_sys(cpu, "scaling_cur_freq");
+      if (core.curFd >= 0) { // Else no cpufreq: do not retry the limits
+        core.minPath = cpufreq_file(cpu, "scaling_min_freq");
+        core.maxPath = cpufreq_file(cpu, "scaling_max_freq");
+      }
+      // Device nodes are never part of a captured tree
+      if (!has_sys_root()) {
+        std::string msr = "/dev/cpu/" + std::to_string(cpu) + "/msr";
+        core.msrFd = open_counted(msr.c_str());
+      }
+      cores.push_back(core);
+    }
+  }
+
+  void close_cores() {
+    for (Core &core : cores) {
+      for (int fd : {core.curFd, core.msrFd}) {
+        if (fd >= 0)
+          ::close(fd);
+      }
+    }
+    cores.clear();
+  }
+
+  /**
+   * @brief Reads a cpufreq file (kHz) and returns MHz, or -1.
+   */
+  double read_kHz(int fd) {
+    if (fd < 0 || !read_fd(fd, buffer))
+      return -1;
+    return parse_kHz();
+  }
+
+  double read_kHz(const std::string &file) {
+    if (file.empty() || !read_proc_file(file.c_str(), buffer))
+      return -1;
+    return parse_kHz();
+  }
+
+  double parse_kHz() const {
+    const char *p = buffer.data();
+    const char *end = p + buffer.size();
+    p = skip_blanks(p, end);
+    if (p == end || *p < '0' || *p > '9')
+      return -1; // e.g. "<unknown>"
+    return static_cast<double>(scan_ll(p, end)) / 1000.0;
+  }
+
+  static bool read_msr(int fd, uint32_t reg, uint64_t &value) {
+    uint64_t start = monotonic_ns();
+    ssize_t n = ::pread(fd, &value, sizeof(value), static_cast<off_t>(reg));
+    count_syscall(start, n > 0 ? static_cast<uint64_t>(n) : 0);
+    return n == static_cast<ssize_t>(sizeof(value));
+  }
+
+  /**
+   * @brief Fills cpuinfoMHz from the "processor" and "cpu MHz" lines.
+   */
+  void read_cpuinfo_MHz() {
+    cpuinfoMHz.clear();
+    if (!read_proc_file("/proc/cpuinfo", buffer))
+      return;
+    const char *p = buffer.data();
+    const char *end = p + buffer.size();
+    long long processor = -1;
+    while (p < end) {
+      const char *line = p;
+      p = next_line(p, end);
+      size_t len = static_cast<size_t>(p - line);
+      if (len > 9 && std::char_traits<char>::compare(line, "processor", 9) == 0) {
+        const char *v = line + 9;
+        while (v < p && (*v == ' ' || *v == '\t' || *v == ':'))
+          ++v;
+        processor = scan_ll(v, p);
+      } else if (len > 7 && processor >= 0 && processor < 65536 &&
+                 std::char_traits<char>::compare(line, "cpu MHz", 7) == 0) {
+        const char *v = line + 7;
+        while (v < p && (*v == ' ' || *v == '\t' || *v == ':'))
+          ++v;
+        if (cpuinfoMHz.size() <= static_cast<size_t>(processor))
+          cpuinfoMHz.resize(static_cast<size_t>(processor) + 1, -1.0);
+        // Stops at the newline (the buffer is NUL-terminated)
+        cpuinfoMHz[processor] = std::strtod(v, nullptr);
+      }
+    }
+  }
+};
+
+} // namespace LiveView
+
+#endif // __linux__
+#endif // CPU_FREQ_HPP
@@ -0,0 +1,288 @@
+/*
+================================================================================
+ MIT License
+
+ Copyright (c) 2025 gafoo
+
+ This file is part of the HardView project:
+ https://github.com/gafoo173/HardView
+
+ Licensed under the MIT License.
+ See the LICENSE file in the project root for more details.
+================================================================================
+*/
+// ===================================================================================
+// Hotplug.hpp: Per-subsystem change counters driven by device hotplug (Linux).
+//
+// A background thread listens to the kernel uevents (NETLINK_KOBJECT_UEVENT,
+// the messages udev itself consumes) and bumps a generation counter for the
+// SUBSYSTEM of every add, remove, move, change, bind or unbind. Inventory
+// caches compare the generation of their subsystem with the one they were
+// filled at, so a cached value stays valid until a device of that kind
+// actually changes.
+//
+// Where the uevent socket cannot be bound (some sandboxes), inotify watches
+// on the class directories and on the device nodes udev creates are used
+// instead. sysfs only reports some changes through inotify, so the /dev
+// watches (/dev, /dev/bus/usb, /dev/dri) carry most of that fallback. With
+// neither source, generation() changes on every call and nothing is cached.
+// Lost messages (a full socket buffer) invalidate every subsystem.
+// ===================================================================================
+#ifndef HOTPLUG_HPP
+#define HOTPLUG_HPP
+#pragma once
+
+#ifdef __linux__
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <dirent.h>
+#include <linux/netlink.h>
+#include <poll.h>
+#include <sys/inotify.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace LiveView {
+
+/**
+ * @brief Where HotplugMonitor gets its events from.
+ */
+enum HotplugSource : int {
+  HOTPLUG_NONE = 0,    // Nothing: every generation() call is a change
+  HOTPLUG_UEVENT = 1,  // Kernel uevents over netlink
+  HOTPLUG_INOTIFY = 2, // inotify on sysfs class directories and /dev
+};
+
+namespace detail {
+/**
+ * @brief Directories watched by the inotify fallback, per subsystem.
+ */
+inline const std::vector<std::pair<const char *, const char *>> &
+hotplug_watches() {
+  static const std::vector<std::pair<const char *, const char *>> watches = {
+      {"pci", "/sys/bus/pci/devices"},
+      {"usb", "/sys/bus/usb/devices"},
+      {"usb", "/dev/bus/usb"},
+      {"block", "/sys/class/block"},
+      {"block", "/dev"},
+      {"drm", "/sys/class/drm"},
+      {"drm", "/dev/dri"},
+      {"kfd", "/sys/class/kfd"},
+      {"power_supply", "/sys/class/power_supply"},
+      {"net", "/sys/class/net"}};
+  return watches;
+}
+} // namespace detail
+
+/**
+ * @class HotplugMonitor
+ * @brief The process-wide hotplug listener. Its thread starts with the
+ * first generation() call (and again in a forked child). Thread-safe.
+ */
+class HotplugMonitor {
+public:
+  static HotplugMonitor &instance() {
+    // Leaked: the listener thread runs until the process exits
+    static HotplugMonitor *monitor = new HotplugMonitor();
+    return *monitor;
+  }
+
+  HotplugMonitor(const HotplugMonitor &) = delete;
+  HotplugMonitor &operator=(const HotplugMonitor &) = delete;
+
+  /**
+   * @brief Change counter of a subsystem ("pci", "usb", "block", "drm"...,
+   * the SUBSYSTEM of the uevents). Two equal values mean no device of that
+   * subsystem was added, removed or changed in between.
+   */
+  uint64_t generation(const std::string &subsystem) {
+    std::lock_guard<std::mutex> lock(mutex);
+    start_locked();
+    if (source == HOTPLUG_NONE)
+      return ++lost;
+    auto it = generations.find(subsystem);
+    return lost + (it == generations.end() ? 0 : it->second);
+  }
+
+  /**
+   * @brief The event source in use (starts the listener if needed).
+   */
+  HotplugSource get_source() {
+    std::lock_guard<std::mutex> lock(mutex);
+    start_locked();
+    return source;
+  }
+
+  /**
+   * @brief Marks every subsystem as changed, e.g. after a change the
+   * kernel does not announce.
+   */
+  void invalidate_all() {
+    std::lock_guard<std::mutex> lock(mutex);
+    ++lost;
+  }
+
+private:
+  std::mutex mutex;
+  std::map<std::string, uint64_t> generations;
+  std::map<int, std::string> watchSubsystem; // inotify descriptor -> subsystem
+  uint64_t lost = 0; // Added to every generation
+  HotplugSource source = HOTPLUG_NONE;
+  pid_t owner = 0; // Process that started the listener
+  int fd = -1;
+
+  HotplugMonitor() = default;
+
+  void start_locked() {
+    pid_t pid = ::getpid();
+    if (owner == pid)
+      return;
+    if (owner != 0) {
+      // Forked child: the listener thread did not survive the fork
+      ::close(fd);
+      watchSubsystem.clear();
+      ++lost;
+    }
+    owner = pid;
+    source = HOTPLUG_NONE;
+    // The socket is bound before returning, so no event that follows this
+    // first call can be missed.
+    if ((fd = open_uevent()) >= 0)
+      source = HOTPLUG_UEVENT;
+    else if ((fd = open_inotify()) >= 0)
+      source = HOTPLUG_INOTIFY;
+    else
+      return;
+    std::thread(&HotplugMonitor::run, this, fd, source).detach();
+  }
+
+  static int open_uevent() {
+    int sock = ::socket(AF_NETLINK, SOCK_DGRAM | SOCK_CLOEXEC,
+                        NETLINK_KOBJECT_UEVENT);
+    if (sock < 0)
+      return -1;
+    sockaddr_nl addr{};
+    addr.nl_family = AF_NETLINK;
+    addr.nl_groups = 1; // Kernel messages (2 is the udev daemon's group)
+    if (::bind(sock, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) != 0) {
+      ::close(sock);
+      return -1;
+    }
+    int size = 1 << 20; // Coldplug and docking stations send bursts
+    ::setsockopt(sock, SOL_SOCKET, SO_RCVBUF, &size, sizeof(size));
+    return sock;
+  }
+
+  int open_inotify() {
+    int ifd = ::inotify_init1(IN_CLOEXEC);
+    if (ifd < 0)
+      return -1;
+    const uint32_t mask = IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO;
+    for (const auto &watch : detail::hotplug_watches()) {
+      int wd = ::inotify_add_watch(ifd, watch.second, mask | IN_ONLYDIR);
+      if (wd >= 0)
+        watchSubsystem[wd] = watch.first;
+    }
+    // Device nodes of USB devices live one level down, per bus
+    if (DIR *dir = ::opendir("/dev/bus/usb")) {
+      while (dirent *entry = ::readdir(dir)) {
+        if (entry->d_name[0] == '.')
+          continue;
+        std::string bus = std::string("/dev/bus/usb/") + entry->d_name;
+        int wd = ::inotify_add_watch(ifd, bus.c_str(), mask | IN_ONLYDIR);
+        if (wd >= 0)
+          watchSubsystem[wd] = "usb";
+      }
+      ::closedir(dir);
+    }
+    if (watchSubsystem.empty()) {
+      ::close(ifd);
+      return -1;
+    }
+    return ifd;
+  }
+
+  void run(int listenFd, HotplugSource kind) {
+    std::vector<char> buffer(16384);
+    pollfd pfd{listenFd, POLLIN, 0};
+    for (;;) {
+      if (::poll(&pfd, 1, -1) < 0) {
+        if (errno == EINTR)
+          continue;
+        return;
+      }
+      ssize_t n = ::read(listenFd, buffer.data(), buffer.size());
+      std::lock_guard<std::mutex> lock(mutex);
+      if (owner != ::getpid() || fd != listenFd)
+        return; // Replaced after a fork
+      if (n < 0) {
+        if (errno == ENOBUFS)
+          ++lost; // Messages were dropped: anything may have changed
+        else if (errno != EINTR && errno != EAGAIN)
+          return;
+        continue;
+      }
+      if (kind == HOTPLUG_UEVENT)
+        handle_uevent(buffer.data(), static_cast<size_t>(n));
+      else
+        handle_inotify(buffer.data(), static_cast<size_t>(n));
+    }
+  }
+
+  /**
+   * @brief A uevent is "ACTION@DEVPATH" followed by NUL-separated KEY=VALUE
+   * lines, among them ACTION and SUBSYSTEM.
+   */
+  void handle_uevent(const char *data, size_t size) {
+    const char *end = data + size;
+    const char *action = nullptr;
+    const char *subsystem = nullptr;
+    for (const char *p = data; p < end; p += std::strlen(p) + 1) {
+      if (std::memchr(p, '\0', end - p) == nullptr)
+        break; // Truncated message
+      if (std::strncmp(p, "ACTION=", 7) == 0)
+        action = p + 7;
+      else if (std::strncmp(p, "SUBSYSTEM=", 10) == 0)
+        subsystem = p + 10;
+    }
+    if (!action || !subsystem)
+      return;
+    for (const char *known :
+         {"add", "remove", "move", "change", "bind", "unbind", "online",
+          "offline"}) {
+      if (std::strcmp(action, known) == 0) {
+        ++generations[subsystem];
+        return;
+      }
+    }
+  }
+
+  void handle_inotify(const char *data, size_t size) {
+    size_t offset = 0;
+    while (offset + sizeof(inotify_event) <= size) {
+      const inotify_event *event =
+          reinterpret_cast<const inotify_event *>(data + offset);
+      if (event->mask & IN_Q_OVERFLOW) {
+        ++lost;
+      } else {
+        auto it = watchSubsystem.find(event->wd);
+        if (it != watchSubsystem.end())
+          ++generations[it->second];
+      }
+      offset += sizeof(inotify_event) + event->len;
+    }
+  }
+};
+
+} // namespace LiveView
+
+#endif // __linux__
+#endif // HOTPLUG_HPP
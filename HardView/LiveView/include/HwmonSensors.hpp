@@ -0,0 +1,214 @@
+/*
+================================================================================
+ MIT License
+
+ Copyright (c) 2025 gafoo
+
+ This file is part of the HardView project:
+ https://github.com/gafoo173/HardView
+
+ Licensed under the MIT License.
+ See the LICENSE file in the project root for more details.
+================================================================================
+*/
+// ===================================================================================
+// HwmonSensors.hpp: Direct reader for the hwmon sysfs interface (Linux).
+//
+// Enumerates /sys/class/hwmon/hwmon*/ once, the way libsensors does, and
+// keeps every *_input file open. A refresh is then one pread() per sensor
+// and an integer parse; no lm-sensors configuration is loaded. Labels are
+// the *_label file contents or the feature name ("temp1"), i.e. what
+// libsensors reports when sensors.conf does not relabel a sensor.
+// ===================================================================================
+#ifndef HWMON_SENSORS_HPP
+#define HWMON_SENSORS_HPP
+#pragma once
+
+#ifdef __linux__
+#include <cerrno>
+#include <cstring>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "CollectorStats.hpp"
+#include "ProcReader.hpp"
+
+namespace LiveView {
+
+/**
+ * @brief One hwmon feature (e.g. temp1 of coretemp).
+ */
+struct HwmonFeature {
+  std::string label; // *_label content, or the feature name
+  std::string chip;  // Content of the hwmon "name" file
+  int type;          // Index into hwmon_feature_types()
+  int fd;            // Open *_input (or equivalent) file, -1 if none
+  double scale;      // Divisor from sysfs units to libsensors units
+};
+
+/**
+ * @brief Feature types known to libsensors, in the order libsensors lists
+ * them within a chip, with the value file and unit divisor of each.
+ */
+struct HwmonFeatureType {
+  const char *prefix;
+  const char *input; // Value file suffix(es), first existing one is used
+  const char *fallback;
+  double scale;
+};
+
+inline const std::vector<HwmonFeatureType> &hwmon_feature_types() {
+  static const std::vector<HwmonFeatureType> types = {
+      {"in", "_input", nullptr, 1000.0},       // mV -> V
+      {"fan", "_input", nullptr, 1.0},         // RPM
+      {"temp", "_input", nullptr, 1000.0},     // m°C -> °C
+      {"power", "_average", "_input", 1e6},    // µW -> W
+      {"energy", "_input", nullptr, 1e6},      // µJ -> J
+      {"curr", "_input", nullptr, 1000.0},     // mA -> A
+      {"humidity", "_input", nullptr, 1000.0}, // m%RH -> %RH
+      {"intrusion", "_alarm", nullptr, 1.0},   // 0/1
+  };
+  return types;
+}
+
+/**
+ * @brief Reads a small sysfs file and strips the trailing newline.
+ */
+inline bool read_sysfs_string(const std::string &path, std::string &out) {
+  int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0)
+    return false;
+  char buffer[256];
+  ssize_t n;
+  do {
+    n = read(fd, buffer, sizeof(buffer) - 1);
+  } while (n < 0 && errno == EINTR);
+  close(fd);
+  if (n < 0)
+    return false;
+  while (n > 0 && (buffer[n - 1] == '\n' || buffer[n - 1] == ' '))
+    --n;
+  out.assign(buffer, static_cast<size_t>(n));
+  return true;
+}
+
+/**
+ * @brief Reads a hwmon value through an open descriptor.
+ * @param fd Descriptor of a *_input file.
+ * @param scale Divisor applied to the integer read.
+ * @param value Output value.
+ * @return False if the read failed (sensor not ready, device removed...).
+ */
+inline bool read_hwmon_value(int fd, double scale, double &value) {
+  char buffer[32];
+  ssize_t n;
+  do {
+    uint64_t start = monotonic_ns();
+    n = pread(fd, buffer, sizeof(buffer), 0);
+    count_syscall(start, n > 0 ? static_cast<uint64_t>(n) : 0);
+  } while (n < 0 && errno == EINTR);
+  if (n <= 0)
+    return false;
+  const char *p = buffer;
+  const char *end = buffer + n;
+  bool negative = p < end && *p == '-';
+  if (negative)
+    ++p;
+  if (p == end || *p < '0' || *p > '9')
+    return false;
+  long long raw = 0;
+  while (p < end && *p >= '0' && *p <= '9')
+    raw = raw * 10 + (*p++ - '0');
+  value = static_cast<double>(negative ? -raw : raw) / scale;
+  return true;
+}
+
+/**
+ * @brief Closes the descriptors of a feature list.
+ */
+inline void close_hwmon_features(std::vector<HwmonFeature> &features) {
+  for (HwmonFeature &f : features) {
+    if (f.fd >= 0)
+      close(f.fd);
+  }
+  features.clear();
+}
+
+/**
+ * @brief Enumerates every hwmon feature and opens its value file.
+ * Chips are listed in directory order and features by type then number,
+ * as libsensors does. The caller owns the descriptors.
+ * @param root The hwmon class directory, by default the one of the sysroot.
+ */
+inline std::vector<HwmonFeature>
+scan_hwmon(const std::string &root = sys_path(std::string("/sys/class/hwmon"))) {
+  std::vector<HwmonFeature> features;
+  DIR *hwmon = opendir(root.c_str());
+  if (!hwmon)
+    return features;
+
+  const auto &types = hwmon_feature_types();
+  while (dirent *chipEntry = readdir(hwmon)) {
+    if (chipEntry->d_name[0] == '.')
+      continue;
+    // Old drivers keep their attributes in the parent device directory.
+    std::string dir = root + "/" + chipEntry->d_name;
+    std::string chip;
+    if (!read_sysfs_string(dir + "/name", chip)) {
+      dir += "/device";
+      if (!read_sysfs_string(dir + "/name", chip))
+        continue;
+    }
+
+    DIR *attrs = opendir(dir.c_str());
+    if (!attrs)
+      continue;
+    // (type, number) -> feature name ("temp1"), ordered like libsensors
+    std::map<std::pair<int, int>, std::string> found;
+    while (dirent *attr = readdir(attrs)) {
+      const char *name = attr->d_name;
+      for (size_t t = 0; t < types.size(); ++t) {
+        size_t len = std::strlen(types[t].prefix);
+        if (std::strncmp(name, types[t].prefix, len) != 0)
+          continue;
+        const char *p = name + len;
+        if (*p < '0' || *p > '9')
+          continue; // "in" must not match "intrusion0_alarm"
+        int number = 0;
+        while (*p >= '0' && *p <= '9')
+          number = number * 10 + (*p++ - '0');
+        if (*p == '_' && std::strcmp(p, "_label") != 0)
+          found.emplace(std::make_pair(static_cast<int>(t), number),
+                        std::string(name, static_cast<size_t>(p - name)));
+        break;
+      }
+    }
+    closedir(attrs);
+
+    for (const auto &item : found) {
+      const HwmonFeatureType &type = types[item.first.first];
+      const std::string base = dir + "/" + item.second;
+      HwmonFeature f{item.second, chip, item.first.first, -1, type.scale};
+      std::string label;
+      if (read_sysfs_string(base + "_label", label) && !label.empty())
+        f.label = label;
+      f.fd = open((base + type.input).c_str(), O_RDONLY | O_CLOEXEC);
+      if (f.fd < 0 && type.fallback)
+        f.fd = open((base + type.fallback).c_str(), O_RDONLY | O_CLOEXEC);
+      features.push_back(std::move(f));
+    }
+  }
+  closedir(hwmon);
+  return features;
+}
+
+} // namespace LiveView
+
+#endif // __linux__
+#endif // HWMON_SENSORS_HPP
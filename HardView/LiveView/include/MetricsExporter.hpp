@@ -0,0 +1,563 @@
+/*
+================================================================================
+ MIT License
+
+ Copyright (c) 2025 gafoo
+
+ This file is part of the HardView project:
+ https://github.com/gafoo173/HardView
+
+ Licensed under the MIT License.
+ See the LICENSE file in the project root for more details.
+================================================================================
+*/
+// ===================================================================================
+// MetricsExporter.hpp: Prometheus / OpenMetrics text exposition and a minimal
+// HTTP endpoint serving it (Linux).
+//
+// MetricsTemplate renders everything that does not change between scrapes
+// (HELP and TYPE lines, metric names and escaped label sets) once, for both
+// the Prometheus text format 0.0.4 and OpenMetrics 1.0. Rendering a scrape
+// only appends the numbers to those prefixes.
+//
+// MetricsServer answers "GET /metrics" on one background thread, one
+// connection at a time (Connection: close). Bodies come from a callback that
+// runs on the server thread, so a caller can cache the rendered text and
+// serve a scrape with one buffer copy. Each connection gets 2 seconds in
+// total to send its request and take the answer, so a slow or stalled
+// client cannot hold the server. The server speaks just enough
+// HTTP/1.x for Prometheus, curl and wget; it is meant for a loopback or
+// otherwise trusted address, not for the open internet.
+// ===================================================================================
+#ifndef METRICS_EXPORTER_HPP
+#define METRICS_EXPORTER_HPP
+#pragma once
+
+#ifdef __linux__
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <strings.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+namespace LiveView {
+
+enum MetricType { METRIC_GAUGE = 0, METRIC_COUNTER = 1 };
+
+/**
+ * @brief Exposition formats understood by MetricsTemplate.
+ */
+enum MetricsFormat { METRICS_PROMETHEUS = 0, METRICS_OPENMETRICS = 1 };
+
+constexpr const char *METRICS_CONTENT_TYPE[2] = {
+    "text/plain; version=0.0.4; charset=utf-8",
+    "application/openmetrics-text; version=1.0.0; charset=utf-8"};
+
+using MetricLabels = std::vector<std::pair<std::string, std::string>>;
+
+/**
+ * @brief Validates a metric or label name ([a-zA-Z_:][a-zA-Z0-9_:]*; no ':'
+ * in label names).
+ */
+inline bool valid_metric_name(const std::string &name, bool label) {
+  if (name.empty() || (name[0] >= '0' && name[0] <= '9'))
+    return false;
+  for (char c : name) {
+    bool ok = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+              (c >= '0' && c <= '9') || c == '_' || (!label && c == ':');
+    if (!ok)
+      return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Appends a label value with '\\', '"' and newlines escaped.
+ */
+inline void append_label_value(std::string &out, const std::string &value) {
+  for (char c : value) {
+    if (c == '\\')
+      out += "\\\\";
+    else if (c == '"')
+      out += "\\\"";
+    else if (c == '\n')
+      out += "\\n";
+    else
+      out += c;
+  }
+}
+
+/**
+ * @brief Appends a sample value ("NaN", "+Inf" and "-Inf" for non-finite
+ * values; integers below 2^53 are printed exactly).
+ */
+inline void append_metric_value(std::string &out, double value) {
+  if (std::isnan(value)) {
+    out += "NaN";
+  } else if (std::isinf(value)) {
+    out += value > 0 ? "+Inf" : "-Inf";
+  } else {
+    char buffer[32];
+    int n = std::snprintf(buffer, sizeof(buffer), "%.15g", value);
+    if (std::fabs(value) >= 1e15 && value == std::floor(value) &&
+        std::fabs(value) < 9007199254740992.0)
+      n = std::snprintf(buffer, sizeof(buffer), "%.0f", value);
+    out.append(buffer, static_cast<size_t>(n));
+  }
+}
+
+/**
+ * @class MetricsTemplate
+ * @brief A fixed set of metric families and series whose text is rendered
+ * once; render() fills in the values.
+ *
+ * Families are added with add_family() and series of the last family with
+ * add_series(); each series gets the next value slot, in order. Counter
+ * samples are named <family>_total.
+ */
+class MetricsTemplate {
+  struct Family {
+    std::string name;
+    std::string help;
+    MetricType type;
+  };
+
+  MetricLabels constLabels;
+  std::vector<Family> families;
+  bool newFamily = false; // The next series starts the last family
+  // Text written before value slot i, per format: the HELP/TYPE lines when
+  // the slot starts a family, then "name{labels} ".
+  std::vector<std::string> prefixes[2];
+
+  static void append_help(std::string &out, const std::string &help) {
+    for (char c : help) {
+      if (c == '\\')
+        out += "\\\\";
+      else if (c == '\n')
+        out += "\\n";
+      else
+        out += c;
+    }
+  }
+
+public:
+  /**
+   * @brief Creates an empty template.
+   * @param labels Labels added to every series (e.g. {"host", "web1"}).
+   * @throws std::invalid_argument If a label name is invalid.
+   */
+  explicit MetricsTemplate(const MetricLabels &labels = {})
+      : constLabels(labels) {
+    for (const auto &l : constLabels)
+      if (!valid_metric_name(l.first, true) || l.first.compare(0, 2, "__") == 0)
+        throw std::invalid_argument("Invalid label name: " + l.first);
+  }
+
+  /**
+   * @brief Starts a metric family. Counter names must not end in "_total".
+   * @throws std::invalid_argument If the name is invalid.
+   */
+  void add_family(const std::string &name, const std::string &help,
+                  MetricType type) {
+    if (!valid_metric_name(name, false))
+      throw std::invalid_argument("Invalid metric name: " + name);
+    families.push_back({name, help, type});
+    newFamily = true;
+  }
+
+  /**
+   * @brief Adds a series to the last family.
+   * @param labels Labels of this series, after the constant labels.
+   * @return The value slot of the series.
+   * @throws std::invalid_argument If there is no family or a label name is
+   * invalid.
+   */
+  size_t add_series(const MetricLabels &labels = {}) {
+    if (families.empty())
+      throw std::invalid_argument("add_series() called before add_family().");
+    const Family &family = families.back();
+    std::string sample = family.name;
+    if (family.type == METRIC_COUNTER)
+      sample += "_total";
+
+    std::string labelText;
+    size_t count = 0;
+    const MetricLabels *sets[2] = {&constLabels, &labels};
+    for (const MetricLabels *set : sets) {
+      for (const auto &l : *set) {
+        if (!valid_metric_name(l.first, true))
+          throw std::invalid_argument("Invalid label name: " + l.first);
+        labelText += count++ ? "," : "{";
+        labelText += l.first;
+        labelText += "=\"";
+        append_label_value(labelText, l.second);
+        labelText += '"';
+      }
+    }
+    if (count)
+      labelText += '}';
+
+    for (int format = 0; format < 2; ++format) {
+      std::string prefix;
+      if (newFamily) {
+        // Prometheus 0.0.4 describes counters by their sample name,
+        // OpenMetrics by the family name.
+        const std::string &described =
+            format == METRICS_OPENMETRICS ? family.name : sample;
+        prefix += "# HELP " + described + ' ';
+        append_help(prefix, family.help);
+        prefix += "\n# TYPE " + described +
+                  (family.type == METRIC_COUNTER ? " counter\n" : " gauge\n");
+      }
+      prefix += sample + labelText + ' ';
+      prefixes[format].push_back(std::move(prefix));
+    }
+    newFamily = false;
+    return prefixes[0].size() - 1;
+  }
+
+  /**
+   * @brief Number of value slots.
+   */
+  size_t size() const { return prefixes[0].size(); }
+
+  /**
+   * @brief Renders the first `count` series into `out` (replacing it).
+   * @param values At least `count` values, in slot order.
+   */
+  void render(const double *values, size_t count, MetricsFormat format,
+              std::string &out) const {
+    const std::vector<std::string> &p = prefixes[format];
+    if (count > p.size())
+      count = p.size();
+    out.clear();
+    for (size_t i = 0; i < count; ++i) {
+      out += p[i];
+      append_metric_value(out, values[i]);
+      out += '\n';
+    }
+    if (format == METRICS_OPENMETRICS)
+      out += "# EOF\n";
+  }
+};
+
+/**
+ * @class MetricsServer
+ * @brief Serves "GET /metrics" on a TCP address from a background thread.
+ */
+class MetricsServer {
+public:
+  /**
+   * @brief Produces the body of a scrape. Runs on the server thread.
+   */
+  using Handler = std::function<const std::string &(MetricsFormat)>;
+
+private:
+  std::string address;
+  int requestedPort;
+  Handler handler;
+
+  int listenFd = -1;
+  int wakePipe[2] = {-1, -1};
+  int boundPort = 0;
+  std::thread worker;
+  std::atomic<bool> running{false};
+  std::atomic<uint64_t> scrapes{0};
+
+  static constexpr size_t MAX_REQUEST = 8192;
+  static constexpr int REQUEST_TIMEOUT_MS = 2000; // Per connection, in total
+
+  using Deadline = std::chrono::steady_clock::time_point;
+
+  /**
+   * @brief Waits until `fd` is ready for `events`, the deadline passes or
+   * the server is stopped.
+   * @return False on timeout, stop or error.
+   */
+  bool wait_for(int fd, short events, Deadline deadline) {
+    for (;;) {
+      auto left = std::chrono::duration_cast<std::chrono::milliseconds>(
+                      deadline - std::chrono::steady_clock::now())
+                      .count();
+      if (left <= 0)
+        return false;
+      struct pollfd p[2] = {{fd, events, 0}, {wakePipe[0], POLLIN, 0}};
+      int ready = ::poll(p, 2, static_cast<int>(left));
+      if (ready < 0 && errno == EINTR)
+        continue;
+      return ready > 0 && !p[1].revents &&
+             (p[0].revents & (events | POLLHUP | POLLERR));
+    }
+  }
+
+  void close_all() {
+    for (int *fd : {&listenFd, &wakePipe[0], &wakePipe[1]}) {
+      if (*fd >= 0)
+        ::close(*fd);
+      *fd = -1;
+    }
+  }
+
+  void send_all(int fd, const std::string &head, const char *body,
+                size_t bodySize, Deadline deadline) {
+    struct iovec iov[2] = {{const_cast<char *>(head.data()), head.size()},
+                           {const_cast<char *>(body), bodySize}};
+    int first = 0;
+    while (first < 2) {
+      struct msghdr msg {};
+      msg.msg_iov = iov + first;
+      msg.msg_iovlen = 2 - first;
+      ssize_t n = ::sendmsg(fd, &msg, MSG_NOSIGNAL);
+      if (n < 0) {
+        if (errno == EINTR)
+          continue;
+        if (errno != EAGAIN && errno != EWOULDBLOCK)
+          return;
+        if (!wait_for(fd, POLLOUT, deadline))
+          return; // The client does not read
+        continue;
+      }
+      size_t sent = static_cast<size_t>(n);
+      while (first < 2 && sent >= iov[first].iov_len)
+        sent -= iov[first++].iov_len;
+      if (first < 2) {
+        iov[first].iov_base = static_cast<char *>(iov[first].iov_base) + sent;
+        iov[first].iov_len -= sent;
+      }
+    }
+  }
+
+  void respond(int fd, const char *status, const char *type, const char *body,
+               size_t bodySize, bool head, Deadline deadline) {
+    std::string header = std::string("HTTP/1.1 ") + status +
+                         "\r\nContent-Type: " + type +
+                         "\r\nContent-Length: " + std::to_string(bodySize) +
+                         "\r\nConnection: close\r\n\r\n";
+    send_all(fd, header, body, head ? 0 : bodySize, deadline);
+  }
+
+  /**
+   * @brief Reads one request (headers only) and answers it.
+   */
+  void serve(int fd) {
+    Deadline deadline = std::chrono::steady_clock::now() +
+                        std::chrono::milliseconds(REQUEST_TIMEOUT_MS);
+    std::string request;
+    char buffer[2048];
+    while (request.find("\r\n\r\n") == std::string::npos &&
+           request.find("\n\n") == std::string::npos) {
+      if (request.size() >= MAX_REQUEST) {
+        const char *msg = "Request too large\n";
+        respond(fd, "431 Request Header Fields Too Large", "text/plain",
+                msg, std::strlen(msg), false, deadline);
+        return;
+      }
+      if (!wait_for(fd, POLLIN, deadline))
+        return; // Timed out or stopping
+      ssize_t n = ::recv(fd, buffer, sizeof(buffer), 0);
+      if (n < 0 && (errno == EINTR || errno == EAGAIN || errno == EWOULDBLOCK))
+        continue;
+      if (n <= 0)
+        return;
+      request.append(buffer, static_cast<size_t>(n));
+    }
+
+    // Request line: METHOD SP target SP version
+    size_t methodEnd = request.find(' ');
+    size_t targetEnd = methodEnd == std::string::npos
+                           ? std::string::npos
+                           : request.find(' ', methodEnd + 1);
+    if (targetEnd == std::string::npos) {
+      const char *msg = "Bad request\n";
+      respond(fd, "400 Bad Request", "text/plain", msg, std::strlen(msg),
+              false, deadline);
+      return;
+    }
+    std::string method = request.substr(0, methodEnd);
+    std::string target =
+        request.substr(methodEnd + 1, targetEnd - methodEnd - 1);
+    size_t query = target.find('?');
+    if (query != std::string::npos)
+      target.resize(query);
+
+    bool head = method == "HEAD";
+    if (method != "GET" && !head) {
+      const char *msg = "Method not allowed\n";
+      respond(fd, "405 Method Not Allowed", "text/plain", msg,
+              std::strlen(msg), false, deadline);
+      return;
+    }
+    if (target != "/metrics") {
+      const char *msg = "Not found; metrics are served at /metrics\n";
+      respond(fd, "404 Not Found", "text/plain", msg, std::strlen(msg), head,
+              deadline);
+      return;
+    }
+
+    // Prometheus asks for OpenMetrics in its Accept header when it wants it
+    MetricsFormat format = METRICS_PROMETHEUS;
+    size_t headers = request.find('\n');
+    for (size_t pos = headers; pos != std::string::npos;
+         pos = request.find('\n', pos + 1)) {
+      if (strncasecmp(request.c_str() + pos + 1, "accept:", 7) == 0) {
+        size_t eol = request.find('\n', pos + 1);
+        if (request.substr(pos + 1, eol - pos - 1)
+                .find("application/openmetrics-text") != std::string::npos)
+          format = METRICS_OPENMETRICS;
+        break;
+      }
+    }
+
+    try {
+      const std::string &body = handler(format);
+      ++scrapes;
+      respond(fd, "200 OK", METRICS_CONTENT_TYPE[format], body.data(),
+              body.size(), head, deadline);
+    } catch (const std::exception &e) {
+      std::string msg = std::string(e.what()) + "\n";
+      respond(fd, "500 Internal Server Error", "text/plain", msg.data(),
+              msg.size(), false, deadline);
+    }
+  }
+
+  void run() {
+    while (running.load()) {
+      struct pollfd p[2] = {{listenFd, POLLIN, 0}, {wakePipe[0], POLLIN, 0}};
+      if (::poll(p, 2, -1) < 0) {
+        if (errno == EINTR)
+          continue;
+        break;
+      }
+      if (p[1].revents)
+        break;
+      if (!(p[0].revents & POLLIN))
+        continue;
+      // Non-blocking, so a client that stops reading cannot stall send_all
+      int fd =
+          ::accept4(listenFd, nullptr, nullptr, SOCK_CLOEXEC | SOCK_NONBLOCK);
+      if (fd < 0)
+        continue;
+      serve(fd);
+      ::close(fd);
+    }
+  }
+
+public:
+  /**
+   * @brief Creates a server (not started).
+   * @param address Numeric IPv4 or IPv6 address to listen on.
+   * @param port TCP port; 0 picks a free one (see port()).
+   * @param handler Produces the body of every scrape.
+   */
+  MetricsServer(const std::string &address, int port, Handler handler)
+      : address(address), requestedPort(port), handler(std::move(handler)) {
+    if (port < 0 || port > 65535)
+      throw std::invalid_argument("Port out of range: " +
+                                  std::to_string(port));
+  }
+
+  ~MetricsServer() { stop(); }
+
+  MetricsServer(const MetricsServer &) = delete;
+  MetricsServer &operator=(const MetricsServer &) = delete;
+
+  /**
+   * @brief Binds the address and starts serving.
+   * @throws std::runtime_error If the address is invalid or cannot be bound.
+   */
+  void start() {
+    if (running.load())
+      return;
+    struct addrinfo hints {};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_flags = AI_NUMERICHOST | AI_NUMERICSERV | AI_PASSIVE;
+    struct addrinfo *info = nullptr;
+    std::string service = std::to_string(requestedPort);
+    if (::getaddrinfo(address.c_str(), service.c_str(), &hints, &info) != 0 ||
+        !info)
+      throw std::runtime_error("Invalid listen address: " + address);
+
+    listenFd = ::socket(info->ai_family, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    int err = errno;
+    if (listenFd >= 0) {
+      int on = 1;
+      ::setsockopt(listenFd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+      if (::bind(listenFd, info->ai_addr, info->ai_addrlen) != 0 ||
+          ::listen(listenFd, 16) != 0)
+        err = errno;
+      else
+        err = 0;
+    }
+    ::freeaddrinfo(info);
+    if (listenFd < 0 || err != 0 || ::pipe2(wakePipe, O_CLOEXEC) != 0) {
+      if (err == 0)
+        err = errno;
+      close_all();
+      throw std::runtime_error("Failed to listen on " + address + ":" +
+                               service + ": " + std::strerror(err));
+    }
+
+    struct sockaddr_storage bound {};
+    socklen_t length = sizeof(bound);
+    ::getsockname(listenFd, reinterpret_cast<sockaddr *>(&bound), &length);
+    boundPort = ntohs(bound.ss_family == AF_INET6
+                          ? reinterpret_cast<sockaddr_in6 *>(&bound)->sin6_port
+                          : reinterpret_cast<sockaddr_in *>(&bound)->sin_port);
+
+    running.store(true);
+    worker = std::thread(&MetricsServer::run, this);
+  }
+
+  /**
+   * @brief Stops serving and closes the socket.
+   */
+  void stop() {
+    if (!running.exchange(false))
+      return;
+    char c = 0;
+    while (::write(wakePipe[1], &c, 1) < 0 && errno == EINTR) {
+    }
+    if (worker.joinable())
+      worker.join();
+    close_all();
+    boundPort = 0;
+  }
+
+  bool is_running() const { return running.load(); }
+
+  /**
+   * @brief The port being served (0 while stopped).
+   */
+  int port() const { return boundPort; }
+
+  const std::string &get_address() const { return address; }
+
+  /**
+   * @brief Number of /metrics requests answered.
+   */
+  uint64_t scrape_count() const { return scrapes.load(); }
+};
+
+} // namespace LiveView
+
+#endif // __linux__
+#endif // METRICS_EXPORTER_HPP
@@ -0,0 +1,429 @@
+/*
+================================================================================
+ MIT License
+
+ Copyright (c) 2025 gafoo
+
+ This file is part of the HardView project:
+ https://github.com/gafoo173/HardView
+
+ Licensed under the MIT License.
+ See the LICENSE file in the project root for more details.
+================================================================================
+*/
+// ===================================================================================
+// NetlinkStats.hpp: Per-interface network counters over rtnetlink (Linux).
+//
+// One RTM_GETSTATS dump returns the rtnl_link_stats64 block of every link as
+// binary data, so there is no text to parse and the cost stays low with
+// hundreds of (veth) interfaces. NetworkStatsReader uses it by default and
+// falls back to /proc/net/dev when netlink is not available.
+// ===================================================================================
+#ifndef NETLINK_STATS_HPP
+#define NETLINK_STATS_HPP
+#pragma once
+
+#ifdef __linux__
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <linux/if_link.h>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#include <net/if.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "CollectorStats.hpp"
+#include "ProcStats.hpp"
+
+namespace LiveView {
+
+/**
+ * @brief Backends for NetworkStatsReader.
+ */
+enum NetworkBackend : int {
+  NET_BACKEND_AUTO = 0,    // Netlink, falling back to /proc/net/dev
+  NET_BACKEND_NETLINK = 1, // Netlink only
+  NET_BACKEND_PROCFS = 2,  // /proc/net/dev only
+};
+
+/**
+ * @class NetlinkLinkReader
+ * @brief Dumps the counters of all links through NETLINK_ROUTE sockets that
+ * stay open for the lifetime of the reader. Not thread-safe.
+ *
+ * Counters come from an RTM_GETSTATS dump filtered to IFLA_STATS_LINK_64,
+ * which carries nothing but the ifindex and the rtnl_link_stats64 block.
+ * Interface names are resolved from a table filled by an RTM_GETLINK dump;
+ * that (much larger) dump is only repeated when a link is added, removed or
+ * renamed, as reported on the RTMGRP_LINK multicast group. Kernels without
+ * RTM_GETSTATS (< 4.7) use RTM_GETLINK for every read.
+ */
+class NetlinkLinkReader {
+public:
+  NetlinkLinkReader() : buffer(64 * 1024) {
+    fd = open_socket(0);
+    if (fd < 0)
+      return;
+    eventFd = open_socket(RTMGRP_LINK);
+    statsDump = eventFd >= 0 && probe_stats_dump();
+  }
+
+  ~NetlinkLinkReader() {
+    if (fd >= 0)
+      close(fd);
+    if (eventFd >= 0)
+      close(eventFd);
+  }
+
+  NetlinkLinkReader(const NetlinkLinkReader &) = delete;
+  NetlinkLinkReader &operator=(const NetlinkLinkReader &) = delete;
+
+  /**
+   * @brief True if the netlink socket could be opened.
+   */
+  bool is_open() const { return fd >= 0; }
+
+  /**
+   * @brief True if counters are read with RTM_GETSTATS, false if every read
+   * is a full RTM_GETLINK dump.
+   */
+  bool uses_stats_dump() const { return statsDump; }
+
+  /**
+   * @brief Reads the counters of every link except loopback into a table.
+   * @param table Table to update; table.begin_update() is done here.
+   * @return False if the dump failed; the table is then incomplete.
+   */
+  bool read(DeviceTable<NetworkStats> &table) {
+    if (fd < 0)
+      return false;
+    if (statsDump && link_events())
+      namesValid = false;
+    if (!statsDump || !namesValid) {
+      // The link dump carries both the names and the counters.
+      names.clear();
+      if (!dump(RTM_GETLINK, table))
+        return false;
+      // Kernels before 6.7 dump links in hash order (ifindex mod 256)
+      std::sort(names.begin(), names.end(),
+                [](const LinkName &a, const LinkName &b) {
+                  return a.index < b.index;
+                });
+      namesValid = true;
+      return true;
+    }
+    return dump(RTM_GETSTATS, table);
+  }
+
+private:
+  struct LinkName {
+    int index;
+    size_t len;
+    char name[IFNAMSIZ];
+  };
+
+  int fd = -1;
+  int eventFd = -1; // RTMGRP_LINK subscription, non-blocking
+  uint32_t seq = 0;
+  bool statsDump = false;
+  bool namesValid = false;
+  std::vector<char> buffer;
+  std::vector<LinkName> names; // Sorted by ifindex
+  size_t nameCursor = 0;
+
+  static int open_socket(uint32_t groups) {
+    int s = socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC |
+                                   (groups ? SOCK_NONBLOCK : 0),
+                   NETLINK_ROUTE);
+    if (s < 0)
+      return -1;
+    sockaddr_nl local{};
+    local.nl_family = AF_NETLINK; // nl_pid 0: the kernel picks a port id
+    local.nl_groups = groups;
+    if (bind(s, reinterpret_cast<sockaddr *>(&local), sizeof(local)) != 0) {
+      close(s);
+      return -1;
+    }
+    return s;
+  }
+
+  bool send_dump(uint16_t type) {
+    struct {
+      nlmsghdr header;
+      union {
+        ifinfomsg info;
+        if_stats_msg stats;
+      };
+    } request{};
+    request.header.nlmsg_type = type;
+    request.header.nlmsg_flags = NLM_F_REQUEST | NLM_F_DUMP;
+    request.header.nlmsg_seq = ++seq;
+    if (type == RTM_GETSTATS) {
+      request.header.nlmsg_len = NLMSG_LENGTH(sizeof(if_stats_msg));
+      request.stats.family = AF_UNSPEC;
+      request.stats.filter_mask = IFLA_STATS_FILTER_BIT(IFLA_STATS_LINK_64);
+    } else {
+      request.header.nlmsg_len = NLMSG_LENGTH(sizeof(ifinfomsg));
+      request.info.ifi_family = AF_UNSPEC;
+    }
+    sockaddr_nl kernel{};
+    kernel.nl_family = AF_NETLINK;
+    uint64_t start = monotonic_ns();
+    bool sent = sendto(fd, &request, request.header.nlmsg_len, 0,
+                       reinterpret_cast<sockaddr *>(&kernel),
+                       sizeof(kernel)) >= 0;
+    count_syscall(start);
+    return sent;
+  }
+
+  /**
+   * @brief Runs one dump and feeds every reply to the matching parser.
+   */
+  bool dump(uint16_t type, DeviceTable<NetworkStats> &table) {
+    if (!send_dump(type))
+      return false;
+    table.begin_update();
+    nameCursor = 0;
+    for (;;) {
+      uint64_t start = monotonic_ns();
+      ssize_t n = recv(fd, buffer.data(), buffer.size(), MSG_TRUNC);
+      count_syscall(start, n > 0 ? static_cast<uint64_t>(n) : 0);
+      if (n < 0) {
+        if (errno == EINTR)
+          continue;
+        return false;
+      }
+      if (static_cast<size_t>(n) > buffer.size()) {
+        // Cannot happen with a 64 KiB buffer (dump messages are <= 32 KiB),
+        // but never parse a truncated message. Drain the rest of the dump.
+        drain();
+        return false;
+      }
+      int len = static_cast<int>(n);
+      for (auto *h = reinterpret_cast<nlmsghdr *>(buffer.data());
+           NLMSG_OK(h, len); h = NLMSG_NEXT(h, len)) {
+        if (h->nlmsg_seq != seq)
+          continue; // Left over from an earlier, failed dump
+        if (h->nlmsg_type == NLMSG_DONE)
+          return true;
+        if (h->nlmsg_type == NLMSG_ERROR)
+          return false;
+        if (h->nlmsg_type == RTM_NEWLINK)
+          parse_link(h, table);
+        else if (h->nlmsg_type == RTM_NEWSTATS)
+          parse_stats(h, table);
+      }
+    }
+  }
+
+  /**
+   * @brief Checks once that the kernel answers RTM_GETSTATS dumps.
+   */
+  bool probe_stats_dump() {
+    DeviceTable<NetworkStats> scratch; // Nothing is stored: no names yet
+    return dump(RTM_GETSTATS, scratch);
+  }
+
+  /**
+   * @brief Drains the multicast socket.
+   * @return True if a link was added, removed or changed since the last call
+   * (or if notifications were lost).
+   */
+  bool link_events() {
+    bool changed = false;
+    for (;;) {
+      uint64_t start = monotonic_ns();
+      ssize_t n = recv(eventFd, buffer.data(), buffer.size(), MSG_DONTWAIT);
+      count_syscall(start, n > 0 ? static_cast<uint64_t>(n) : 0);
+      if (n < 0) {
+        if (errno == EINTR)
+          continue;
+        if (errno == EAGAIN || errno == EWOULDBLOCK)
+          return changed;
+        return true; // ENOBUFS: notifications were dropped
+      }
+      if (n > 0)
+        changed = true;
+    }
+  }
+
+  void parse_link(const nlmsghdr *h, DeviceTable<NetworkStats> &table) {
+    auto *info = static_cast<const ifinfomsg *>(NLMSG_DATA(h));
+    int len = static_cast<int>(h->nlmsg_len) - NLMSG_LENGTH(sizeof(*info));
+    const char *name = nullptr;
+    size_t name_len = 0;
+    const rtnl_link_stats64 *stats64 = nullptr;
+    const rtnl_link_stats *stats32 = nullptr;
+    for (auto *a = IFLA_RTA(info); RTA_OK(a, len); a = RTA_NEXT(a, len)) {
+      if (a->rta_type == IFLA_IFNAME) {
+        name = static_cast<const char *>(RTA_DATA(a));
+        name_len = strnlen(name, RTA_PAYLOAD(a));
+      } else if (a->rta_type == IFLA_STATS64 &&
+                 RTA_PAYLOAD(a) >= sizeof(rtnl_link_stats64)) {
+        stats64 = static_cast<const rtnl_link_stats64 *>(RTA_DATA(a));
+      } else if (a->rta_type == IFLA_STATS &&
+                 RTA_PAYLOAD(a) >= sizeof(rtnl_link_stats)) {
+        stats32 = static_cast<const rtnl_link_stats *>(RTA_DATA(a));
+      }
+    }
+    if (!name || name_len >= IFNAMSIZ)
+      return;
+    if (name_len == 2 && name[0] == 'l' && name[1] == 'o')
+      return; // Skip loopback, as the /proc/net/dev parser does
+    if (statsDump) {
+      LinkName entry{info->ifi_index, name_len, {}};
+      std::memcpy(entry.name, name, name_len);
+      names.push_back(entry);
+    }
+    if (!stats64 && !stats32)
+      return;
+
+    NetworkStats &s = table.update(name, name_len);
+    if (stats64) {
+      // The attribute payload is only 4-byte aligned; copy it out.
+      rtnl_link_stats64 st;
+      std::memcpy(&st, stats64, sizeof(st));
+      fill(s, st);
+    } else {
+      rtnl_link_stats st;
+      std::memcpy(&st, stats32, sizeof(st));
+      fill(s, st);
+    }
+  }
+
+  void parse_stats(const nlmsghdr *h, DeviceTable<NetworkStats> &table) {
+    if (!namesValid)
+      return;
+    auto *msg = static_cast<const if_stats_msg *>(NLMSG_DATA(h));
+    const LinkName *link = find_name(static_cast<int>(msg->ifindex));
+    if (!link)
+      return; // Loopback, or a link whose RTM_NEWLINK event is still queued
+    int len = static_cast<int>(h->nlmsg_len) - NLMSG_LENGTH(sizeof(*msg));
+    auto *a = reinterpret_cast<const rtattr *>(
+        reinterpret_cast<const char *>(msg) + NLMSG_ALIGN(sizeof(*msg)));
+    for (; RTA_OK(a, len); a = RTA_NEXT(a, len)) {
+      if (a->rta_type == IFLA_STATS_LINK_64 &&
+          RTA_PAYLOAD(a) >= sizeof(rtnl_link_stats64)) {
+        rtnl_link_stats64 st;
+        std::memcpy(&st, RTA_DATA(a), sizeof(st));
+        fill(table.update(link->name, link->len), st);
+        return;
+      }
+    }
+  }
+
+  const LinkName *find_name(int index) {
+    // Recent kernels dump the links in ifindex order, so the entry after
+    // the previous match is usually the next one; else binary search.
+    if (nameCursor < names.size() && names[nameCursor].index == index)
+      return &names[nameCursor++];
+    size_t lo = 0, hi = names.size();
+    while (lo < hi) {
+      size_t mid = (lo + hi) / 2;
+      if (names[mid].index < index)
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
+    if (lo == names.size() || names[lo].index != index)
+      return nullptr;
+    nameCursor = lo + 1;
+    return &names[lo];
+  }
+
+  template <typename Stats> static void fill(NetworkStats &s, const Stats &st) {
+    s.bytes_received = static_cast<long long>(st.rx_bytes);
+    s.packets_received = static_cast<long long>(st.rx_packets);
+    s.errors_received = static_cast<long long>(st.rx_errors);
+    s.drops_received = static_cast<long long>(st.rx_dropped);
+    s.bytes_transmitted = static_cast<long long>(st.tx_bytes);
+    s.packets_transmitted = static_cast<long long>(st.tx_packets);
+    s.errors_transmitted = static_cast<long long>(st.tx_errors);
+    s.drops_transmitted = static_cast<long long>(st.tx_dropped);
+  }
+
+  void drain() {
+    for (;;) {
+      ssize_t n = recv(fd, buffer.data(), buffer.size(), MSG_DONTWAIT);
+      if (n <= 0)
+        return;
+      int len = static_cast<int>(n);
+      for (auto *h = reinterpret_cast<nlmsghdr *>(buffer.data());
+           NLMSG_OK(h, len); h = NLMSG_NEXT(h, len)) {
+        if (h->nlmsg_type == NLMSG_DONE || h->nlmsg_type == NLMSG_ERROR)
+          return;
+      }
+    }
+  }
+};
+
+/**
+ * @class NetworkStatsReader
+ * @brief Reads per-interface counters with the selected backend.
+ * In NET_BACKEND_AUTO mode netlink is used until it fails once, after which
+ * the reader stays on /proc/net/dev. Netlink always reports the live
+ * kernel, so NET_BACKEND_AUTO also reads /proc/net/dev while a sysroot is
+ * set.
+ */
+class NetworkStatsReader {
+public:
+  /**
+   * @param backend One of NET_BACKEND_AUTO, NET_BACKEND_NETLINK or
+   * NET_BACKEND_PROCFS.
+   */
+  explicit NetworkStatsReader(int backend = NET_BACKEND_AUTO) {
+    if (backend != NET_BACKEND_AUTO && backend != NET_BACKEND_NETLINK &&
+        backend != NET_BACKEND_PROCFS)
+      throw std::invalid_argument(
+          "Invalid network backend. Use NET_BACKEND_AUTO, NET_BACKEND_NETLINK "
+          "or NET_BACKEND_PROCFS.");
+    if (backend != NET_BACKEND_PROCFS) {
+      netlink.reset(new NetlinkLinkReader());
+      if (!netlink->is_open()) {
+        if (backend == NET_BACKEND_NETLINK)
+          throw std::runtime_error("Failed to open a NETLINK_ROUTE socket.");
+        netlink.reset();
+      }
+    }
+    strict = backend == NET_BACKEND_NETLINK;
+  }
+
+  /**
+   * @brief Reads all interfaces (loopback excluded) into a table.
+   */
+  void read(DeviceTable<NetworkStats> &table) {
+    CollectorTimer timer(COLLECTOR_NETWORK);
+    if (netlink && (strict || !has_sys_root())) {
+      if (netlink->read(table))
+        return;
+      if (strict)
+        throw std::runtime_error("Netlink RTM_GETLINK dump failed.");
+      netlink.reset(); // Fall back to /proc/net/dev from now on
+    }
+    get_network_stats(procBuffer, table);
+  }
+
+  /**
+   * @brief The backend currently in use: "netlink" or "procfs".
+   */
+  const char *backend() const {
+    return netlink && (strict || !has_sys_root()) ? "netlink" : "procfs";
+  }
+
+private:
+  std::unique_ptr<NetlinkLinkReader> netlink;
+  std::string procBuffer;
+  bool strict = false;
+};
+
+} // namespace LiveView
+
+#endif // __linux__
+#endif // NETLINK_STATS_HPP
@@ -0,0 +1,438 @@
+/*
+================================================================================
+ MIT License
+
+ Copyright (c) 2025 gafoo
+
+ This file is part of the HardView project:
+ https://github.com/gafoo173/HardView
+
+ Licensed under the MIT License.
+ See the LICENSE file in the project root for more details.
+================================================================================
+*/
+// ===================================================================================
+// Pressure.hpp: Pressure stall information (PSI) of the system or of a
+// cgroup v2 group (Linux 4.20+, CONFIG_PSI).
+//
+// Usage percentages say how busy a resource is; PSI says how much time tasks
+// spent waiting for it. Each resource file (/proc/pressure/{cpu,memory,io,
+// irq}, or <cgroup>/{cpu,memory,io,irq}.pressure) has a "some" line (at
+// least one task stalled) and, except for the system-wide cpu file on old
+// kernels, a "full" line (all non-idle tasks stalled at once):
+//
+//   some avg10=0.22 avg60=0.17 avg300=1.11 total=58761459
+//   full avg10=0.00 avg60=0.00 avg300=0.00 total=29435442
+//
+// averages are percentages over 10 s, 60 s and 300 s, total is in
+// microseconds.
+//
+// A trigger is a threshold written into an open resource file, e.g.
+// "some 150000 1000000": 150 ms of stall within any 1 s window. The kernel
+// then flags the descriptor with POLLPRI each time the threshold is crossed
+// (at most once per window), so a monitor can sleep in poll() instead of
+// re-reading the files on a timer. Triggers need write access to the file;
+// without CAP_SYS_RESOURCE (Linux 6.5+ allows unprivileged triggers) the
+// window must be a multiple of 2 s. They only work on the live system, not
+// under a sysroot.
+// ===================================================================================
+#ifndef PRESSURE_HPP
+#define PRESSURE_HPP
+#pragma once
+
+#ifdef __linux__
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+
+#include "ProcReader.hpp"
+
+namespace LiveView {
+
+/**
+ * @brief The PSI resources, in the order returned by read_all().
+ */
+constexpr const char *PRESSURE_RESOURCES[] = {"cpu", "memory", "io", "irq"};
+
+// Limits the kernel puts on a trigger window
+constexpr uint64_t PRESSURE_MIN_WINDOW_US = 500000;
+constexpr uint64_t PRESSURE_MAX_WINDOW_US = 10000000;
+
+/**
+ * @struct PressureLine
+ * @brief One line of a pressure file.
+ */
+struct PressureLine {
+  double avg10 = 0;  // % of time stalled, 10 s average
+  double avg60 = 0;  // % of time stalled, 60 s average
+  double avg300 = 0; // % of time stalled, 300 s average
+  uint64_t total_us = 0; // Total stall time
+};
+
+/**
+ * @struct PressureStats
+ * @brief The content of one pressure file.
+ */
+struct PressureStats {
+  std::string resource; // "cpu", "memory", "io" or "irq"
+  PressureLine some;    // At least one task stalled
+  PressureLine full;    // All non-idle tasks stalled
+  bool has_full = false;
+};
+
+/**
+ * @brief Parses the "some" and "full" lines of a pressure file.
+ * @return False if no "some" line was found.
+ */
+inline bool parse_pressure(const std::string &buffer, PressureStats &stats) {
+  stats.some = PressureLine();
+  stats.full = PressureLine();
+  stats.has_full = false;
+  bool hasSome = false;
+  const char *p = buffer.c_str();
+  const char *end = p + buffer.size();
+  while (p < end) {
+    const char *line = p;
+    const char *eol = next_line(p, end);
+    p = eol;
+    PressureLine *target;
+    if (eol - line > 4 && std::strncmp(line, "some", 4) == 0) {
+      target = &stats.some;
+      hasSome = true;
+    } else if (eol - line > 4 && std::strncmp(line, "full", 4) == 0) {
+      target = &stats.full;
+      stats.has_full = true;
+    } else {
+      continue;
+    }
+    for (const char *q = line + 4; q < eol; ++q) {
+      if (*q != '=')
+        continue;
+      const char *key = q;
+      while (key > line && key[-1] != ' ')
+        --key;
+      size_t len = static_cast<size_t>(q - key);
+      // The buffer is NUL-terminated, so strtod stops at the line end
+      if (len == 5 && std::strncmp(key, "avg10", 5) == 0)
+        target->avg10 = std::strtod(q + 1, nullptr);
+      else if (len == 5 && std::strncmp(key, "avg60", 5) == 0)
+        target->avg60 = std::strtod(q + 1, nullptr);
+      else if (len == 6 && std::strncmp(key, "avg300", 6) == 0)
+        target->avg300 = std::strtod(q + 1, nullptr);
+      else if (len == 5 && std::strncmp(key, "total", 5) == 0)
+        target->total_us = std::strtoull(q + 1, nullptr, 10);
+    }
+  }
+  return hasSome;
+}
+
+/**
+ * @class PressureMonitor
+ * @brief Reads the pressure files of the system or of one cgroup, and
+ * waits on PSI triggers.
+ *
+ * read() and read_all() can be called from any thread. Triggers can be
+ * added and removed while another thread waits: wait() only takes the lock
+ * to copy the descriptors, and a change wakes it up to poll the new set.
+ * Concurrent wait() calls run one at a time.
+ */
+class PressureMonitor {
+public:
+  /**
+   * @param cgroupPath "" for the whole system (/proc/pressure), else a
+   * cgroup v2 directory: absolute under /sys/fs/cgroup, or relative to it.
+   * @throws std::runtime_error If the wake-up pipe cannot be created.
+   */
+  explicit PressureMonitor(const std::string &cgroupPath = "") {
+    if (!cgroupPath.empty()) {
+      const std::string root = "/sys/fs/cgroup";
+      cgroup = cgroupPath.compare(0, root.size(), root) == 0
+                   ? cgroupPath
+                   : root + (cgroupPath[0] == '/' ? "" : "/") + cgroupPath;
+      while (cgroup.back() == '/')
+        cgroup.pop_back();
+    }
+    if (::pipe2(wakePipe, O_CLOEXEC | O_NONBLOCK) != 0)
+      throw std::runtime_error(std::string("Failed to create a pipe: ") +
+                               std::strerror(errno));
+  }
+
+  ~PressureMonitor() {
+    for (const Trigger &t : triggers)
+      ::close(t.fd);
+    for (int fd : retired)
+      ::close(fd);
+    ::close(wakePipe[0]);
+    ::close(wakePipe[1]);
+  }
+
+  PressureMonitor(const PressureMonitor &) = delete;
+  PressureMonitor &operator=(const PressureMonitor &) = delete;
+
+  /**
+   * @brief The cgroup directory ("" for the whole system).
+   */
+  const std::string &get_cgroup() const { return cgroup; }
+
+  /**
+   * @brief Path of a resource's pressure file on the live system.
+   * @throws std::invalid_argument For an unknown resource.
+   */
+  std::string pressure_path(const std::string &resource) const {
+    bool known = false;
+    for (const char *r : PRESSURE_RESOURCES)
+      known = known || resource == r;
+    if (!known)
+      throw std::invalid_argument("Unknown pressure resource: " + resource +
+                                  " (expected cpu, memory, io or irq).");
+    return cgroup.empty() ? "/proc/pressure/" + resource
+                          : cgroup + "/" + resource + ".pressure";
+  }
+
+  /**
+   * @brief Reads one resource.
+   * @throws std::runtime_error If the file is missing (no PSI support, or
+   * the cgroup does not exist) or malformed.
+   */
+  PressureStats read(const std::string &resource) const {
+    PressureStats stats;
+    if (!try_read(resource, stats))
+      throw std::runtime_error(
+          "Failed to read " + pressure_path(resource) +
+          (cgroup.empty() ? ": the kernel needs CONFIG_PSI (and psi=1)."
+                          : ": no such cgroup v2 group or resource."));
+    return stats;
+  }
+
+  /**
+   * @brief Reads every resource that has a pressure file (irq only exists
+   * on Linux 6.1+ with CONFIG_IRQ_TIME_ACCOUNTING).
+   * @throws std::runtime_error If none can be read.
+   */
+  std::vector<PressureStats> read_all() const {
+    std::vector<PressureStats> result;
+    for (const char *resource : PRESSURE_RESOURCES) {
+      PressureStats stats;
+      if (try_read(resource, stats))
+        result.push_back(stats);
+    }
+    if (result.empty())
+      read("cpu"); // Throws with the reason
+    return result;
+  }
+
+  /**
+   * @brief Registers a PSI trigger: it fires when tasks stall for
+   * `stall_us` within any `window_us` window.
+   * @param resource "cpu", "memory", "io" or "irq".
+   * @param full True to count only time when all non-idle tasks stalled.
+   * @return The trigger id, as returned by wait().
+   * @throws std::invalid_argument If the threshold or window is out of the
+   * kernel's range.
+   * @throws std::runtime_error If the kernel refuses the trigger.
+   */
+  int add_trigger(const std::string &resource, bool full, uint64_t stall_us,
+                  uint64_t window_us) {
+    std::string path = pressure_path(resource);
+    if (window_us < PRESSURE_MIN_WINDOW_US ||
+        window_us > PRESSURE_MAX_WINDOW_US)
+      throw std::invalid_argument(
+          "The trigger window must be between 500000 and 10000000 us.");
+    if (stall_us == 0 || stall_us > window_us)
+      throw std::invalid_argument(
+          "The stall threshold must be between 1 us and the window.");
+    if (has_sys_root())
+      throw std::runtime_error(
+          "PSI triggers need the live system; unset the sysroot.");
+
+    std::lock_guard<std::mutex> lock(mutex);
+    int fd = ::open(path.c_str(), O_RDWR | O_NONBLOCK | O_CLOEXEC);
+    if (fd < 0)
+      throw std::runtime_error("Failed to open " + path + ": " +
+                               std::strerror(errno));
+    std::string spec = std::string(full ? "full " : "some ") +
+                       std::to_string(stall_us) + " " +
+                       std::to_string(window_us);
+    // The kernel expects the terminating NUL as part of the write
+    if (::write(fd, spec.c_str(), spec.size() + 1) < 0) {
+      int err = errno;
+      ::close(fd);
+      throw std::runtime_error(
+          "Failed to set the trigger \"" + spec + "\" on " + path + ": " +
+          std::strerror(err) +
+          (err == EACCES || err == EPERM ? " (needs write access)"
+           : err == EINVAL && window_us % 2000000 != 0
+               ? " (without CAP_SYS_RESOURCE the window must be a multiple "
+                 "of 2 s)"
+               : ""));
+    }
+    triggers.push_back(Trigger{nextId, fd});
+    wake_waiter_locked();
+    return nextId++;
+  }
+
+  /**
+   * @brief Removes a trigger.
+   * @return False if the id is unknown.
+   */
+  bool remove_trigger(int id) {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (size_t i = 0; i < triggers.size(); ++i) {
+      if (triggers[i].id == id) {
+        // A running poll() may still use the descriptor: closing it now
+        // would let open() hand the number to another file
+        if (waiting)
+          retired.push_back(triggers[i].fd);
+        else
+          ::close(triggers[i].fd);
+        triggers.erase(triggers.begin() + static_cast<long>(i));
+        wake_waiter_locked();
+        return true;
+      }
+    }
+    return false;
+  }
+
+  size_t trigger_count() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return triggers.size();
+  }
+
+  /**
+   * @brief Sleeps until at least one trigger fires.
+   * @param timeout_ms Maximum time to wait; -1 waits forever.
+   * @return The ids of the triggers that fired. Empty on timeout, on
+   * interrupt() and when a signal arrives.
+   * @throws std::runtime_error If a monitored file went away (its cgroup was
+   * removed); the trigger is removed.
+   */
+  std::vector<int> wait(int timeout_ms) {
+    std::lock_guard<std::mutex> serial(waitMutex);
+    const auto deadline = std::chrono::steady_clock::now() +
+                          std::chrono::milliseconds(timeout_ms);
+    std::vector<int> fired;
+    for (;;) {
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        fds.clear();
+        ids.clear();
+        fds.push_back(pollfd{wakePipe[0], POLLIN, 0});
+        for (const Trigger &t : triggers) {
+          fds.push_back(pollfd{t.fd, POLLPRI, 0});
+          ids.push_back(t.id);
+        }
+        waiting = true;
+      }
+
+      int remaining = timeout_ms;
+      if (timeout_ms > 0) {
+        auto left = std::chrono::duration_cast<std::chrono::milliseconds>(
+                        deadline - std::chrono::steady_clock::now())
+                        .count();
+        remaining = left > 0 ? static_cast<int>(left) : 0;
+      }
+      int ready = ::poll(fds.data(), fds.size(), remaining);
+
+      std::lock_guard<std::mutex> lock(mutex);
+      waiting = false;
+      for (int fd : retired)
+        ::close(fd);
+      retired.clear();
+      if (ready <= 0)
+        return fired; // Timeout or EINTR: let the caller handle the signal
+      if (fds[0].revents) {
+        char drain[64];
+        while (::read(wakePipe[0], drain, sizeof(drain)) > 0) {
+        }
+        if (interrupted.exchange(false))
+          return fired;
+      }
+      for (size_t i = 1; i < fds.size(); ++i) {
+        if (!(fds[i].revents & (POLLERR | POLLPRI)))
+          continue;
+        size_t t = 0;
+        while (t < triggers.size() && triggers[t].id != ids[i - 1])
+          ++t;
+        if (t == triggers.size())
+          continue; // Removed during the poll
+        if (fds[i].revents & POLLERR) {
+          ::close(triggers[t].fd);
+          triggers.erase(triggers.begin() + static_cast<long>(t));
+          throw std::runtime_error("Pressure trigger " +
+                                   std::to_string(ids[i - 1]) +
+                                   ": the monitored file is gone.");
+        }
+        fired.push_back(ids[i - 1]);
+      }
+      if (!fired.empty())
+        return fired;
+      // Only the trigger set changed: poll the new one for the time left
+    }
+  }
+
+  /**
+   * @brief Makes a running (or the next) wait() return. Thread-safe.
+   */
+  void interrupt() {
+    interrupted = true;
+    write_wake_byte();
+  }
+
+private:
+  struct Trigger {
+    int id;
+    int fd;
+  };
+
+  std::string cgroup;
+  std::vector<Trigger> triggers;
+  std::vector<int> retired; // Removed during a wait(), closed after its poll
+  std::vector<pollfd> fds;  // wait() state, guarded by waitMutex
+  std::vector<int> ids;
+  int wakePipe[2] = {-1, -1};
+  int nextId = 1;
+  bool waiting = false; // A wait() is inside poll()
+  std::atomic<bool> interrupted{false};
+  std::mutex mutex;
+  std::mutex waitMutex;
+
+  void write_wake_byte() {
+    char c = 1;
+    while (::write(wakePipe[1], &c, 1) < 0 && errno == EINTR) {
+    }
+  }
+
+  /**
+   * @brief Makes a wait() in poll() pick up a changed trigger set.
+   */
+  void wake_waiter_locked() {
+    if (waiting)
+      write_wake_byte();
+  }
+
+  bool try_read(const std::string &resource, PressureStats &stats) const {
+    static thread_local std::string buffer;
+    std::string path = pressure_path(resource);
+    if (!read_proc_file(path.c_str(), buffer) ||
+        !parse_pressure(buffer, stats))
+      return false;
+    stats.resource = resource;
+    return true;
+  }
+};
+
+} // namespace LiveView
+
+#endif // __linux__
+#endif // PRESSURE_HPP
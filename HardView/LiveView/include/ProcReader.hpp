@@ -0,0 +1,412 @@
+/*
+================================================================================
+ MIT License
+
+ Copyright (c) 2025 gafoo
+
+ This file is part of the HardView project:
+ https://github.com/gafoo173/HardView
+
+ Licensed under the MIT License.
+ See the LICENSE file in the project root for more details.
+================================================================================
+*/
+// ===================================================================================
+// ProcReader.hpp: Low-overhead helpers for reading procfs/sysfs files (Linux).
+//
+// Shared by LiveView.cpp, monitoring/Live.hpp and Linux/info.hpp. Files are
+// kept open in a ProcFileCache and re-read with pread(), the helpers read
+// into caller-owned buffers and scan numbers by hand, so repeated sampling
+// does not allocate once the buffers have grown to their working size.
+//
+// Every path goes through sys_path(), which prepends the sysroot: a directory
+// laid out like / (see Tools/SysCapture) whose proc/ and sys/ subtrees are
+// read instead of the live ones. The sysroot comes from the HARDVIEW_SYSROOT
+// environment variable or set_sys_root(); empty means the live system.
+// ===================================================================================
+#ifndef PROC_READER_HPP
+#define PROC_READER_HPP
+#pragma once
+
+#ifdef __linux__
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "CollectorStats.hpp"
+
+namespace LiveView {
+
+/**
+ * @class SysRoot
+ * @brief Process-wide prefix of the procfs/sysfs paths.
+ *
+ * Readers that keep state derived from the files (open descriptors, sensor
+ * tables) compare generation() with the value they loaded under to notice
+ * a change of root. All methods are thread-safe.
+ */
+class SysRoot {
+public:
+  /**
+   * @brief The root, without a trailing '/' ("" for the live system).
+   */
+  std::string get() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return root;
+  }
+
+  /**
+   * @brief Replaces the root. "" and "/" select the live system.
+   */
+  void set(std::string path) {
+    while (!path.empty() && path.back() == '/')
+      path.pop_back();
+    std::lock_guard<std::mutex> lock(mutex);
+    root = std::move(path);
+    counter.fetch_add(1, std::memory_order_release);
+  }
+
+  /**
+   * @brief Incremented by every set(), starting from 1.
+   */
+  uint64_t generation() const {
+    return counter.load(std::memory_order_acquire);
+  }
+
+  /**
+   * @brief This thread's copy of the root, refreshed when it changed, so
+   * building a path does not lock.
+   */
+  const std::string &cached() {
+    static thread_local std::string copy;
+    static thread_local uint64_t seen = 0;
+    if (seen != generation()) {
+      std::lock_guard<std::mutex> lock(mutex);
+      copy = root;
+      seen = counter.load(std::memory_order_relaxed);
+    }
+    return copy;
+  }
+
+  static SysRoot &instance() {
+    // Never destroyed, like ProcFileCache::instance().
+    static SysRoot *sysRoot = new SysRoot();
+    return *sysRoot;
+  }
+
+private:
+  std::mutex mutex;
+  std::string root;
+  std::atomic<uint64_t> counter{0};
+
+  SysRoot() {
+    const char *env = std::getenv("HARDVIEW_SYSROOT");
+    set(env ? env : "");
+  }
+};
+
+/**
+ * @brief Sets the sysroot used by every Linux reader.
+ * @param root Directory containing proc/ and sys/ like /, or "" to read the
+ * live system again.
+ * @throws std::invalid_argument If root is not a directory.
+ */
+inline void set_sys_root(const std::string &root) {
+  struct stat st;
+  if (!root.empty() && (stat(root.c_str(), &st) != 0 || !S_ISDIR(st.st_mode)))
+    throw std::invalid_argument("Sysroot is not a directory: " + root);
+  SysRoot::instance().set(root);
+}
+
+/**
+ * @brief The current sysroot ("" for the live system).
+ */
+inline std::string get_sys_root() { return SysRoot::instance().get(); }
+
+/**
+ * @brief True while a sysroot is set. Does not lock.
+ */
+inline bool has_sys_root() { return !SysRoot::instance().cached().empty(); }
+
+/**
+ * @brief Changes every time the sysroot is set.
+ */
+inline uint64_t sys_root_generation() {
+  return SysRoot::instance().generation();
+}
+
+/**
+ * @brief Maps an absolute procfs/sysfs path into the sysroot.
+ * @param path Absolute path on the live system, e.g. "/proc/stat".
+ * @param buffer Storage for the prefixed path, reused between calls.
+ * @return `path` itself when no sysroot is set, else buffer.c_str().
+ */
+inline const char *sys_path(const char *path, std::string &buffer) {
+  const std::string &root = SysRoot::instance().cached();
+  if (root.empty())
+    return path;
+  buffer.assign(root);
+  buffer.append(path);
+  return buffer.c_str();
+}
+
+/**
+ * @brief Maps an absolute procfs/sysfs path into the sysroot.
+ */
+inline std::string sys_path(const std::string &path) {
+  return SysRoot::instance().cached() + path;
+}
+
+/**
+ * @brief Reads a whole file from offset 0 through an open descriptor.
+ * The buffer keeps its capacity between calls, so it only allocates while
+ * growing to the size of the file.
+ * @param fd Descriptor opened on a procfs/sysfs file.
+ * @param buffer Output buffer, resized to the number of bytes read.
+ * @return True on success, false on error (errno is preserved).
+ */
+inline bool read_fd(int fd, std::string &buffer) {
+  buffer.resize(buffer.capacity() < 4096 ? 4096 : buffer.capacity());
+  size_t used = 0;
+  for (;;) {
+    if (used == buffer.size())
+      buffer.resize(buffer.size() * 2);
+    uint64_t start = monotonic_ns();
+    ssize_t n = pread(fd, &buffer[used], buffer.size() - used,
+                      static_cast<off_t>(used));
+    count_syscall(start, n > 0 ? static_cast<uint64_t>(n) : 0);
+    if (n < 0) {
+      if (errno == EINTR)
+        continue;
+      buffer.clear();
+      return false;
+    }
+    if (n == 0)
+      break;
+    used += static_cast<size_t>(n);
+  }
+  buffer.resize(used);
+  return true;
+}
+
+/**
+ * @class ProcFileCache
+ * @brief Keeps procfs/sysfs files open between reads.
+ *
+ * Both filesystems regenerate a file's content when it is read again from
+ * offset 0, so a cached descriptor can be re-read with pread() instead of
+ * paying open() + close() and a path lookup on every sample. The number of
+ * open descriptors is bounded; the least recently used one is closed when
+ * the cache is full. A descriptor that fails with ENODEV (its device went
+ * away) is reopened once by path. Changing the sysroot closes every
+ * descriptor. All methods are thread-safe.
+ */
+class ProcFileCache {
+public:
+  explicit ProcFileCache(size_t capacity = 64)
+      : capacity(capacity ? capacity : 1) {}
+
+  ~ProcFileCache() { clear(); }
+
+  ProcFileCache(const ProcFileCache &) = delete;
+  ProcFileCache &operator=(const ProcFileCache &) = delete;
+
+  /**
+   * @brief Reads a whole file, opening it on first use.
+   * @param path The file to read.
+   * @param buffer Output buffer, resized to the number of bytes read.
+   * @return True on success, false if the file could not be opened or read.
+   */
+  bool read(const char *path, std::string &buffer) {
+    std::lock_guard<std::mutex> lock(mutex);
+    uint64_t root = sys_root_generation();
+    if (root != rootGeneration) {
+      // Descriptors of the previous root must not outlive it.
+      for (Entry &e : entries)
+        close(e.fd);
+      entries.clear();
+      rootGeneration = root;
+    }
+    Entry *entry = find(path);
+    if (!entry && !(entry = open_entry(path)))
+      return false;
+    entry->lastUsed = ++clock;
+    if (read_fd(entry->fd, buffer))
+      return true;
+    if (errno == ENODEV) {
+      // The device behind the file was removed (and maybe re-added).
+      close(entry->fd);
+      entry->fd = open_counted(path);
+      if (entry->fd >= 0 && read_fd(entry->fd, buffer))
+        return true;
+    }
+    drop(*entry);
+    return false;
+  }
+
+  /**
+   * @brief Closes every cached descriptor.
+   */
+  void clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (Entry &e : entries)
+      close(e.fd);
+    entries.clear();
+  }
+
+  /**
+   * @brief Number of descriptors currently open.
+   */
+  size_t size() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries.size();
+  }
+
+  /**
+   * @brief The process-wide cache shared by all LiveView readers.
+   */
+  static ProcFileCache &instance() {
+    // Never destroyed, so collector threads still running during static
+    // destruction keep a valid cache.
+    static ProcFileCache *cache = new ProcFileCache();
+    return *cache;
+  }
+
+private:
+  struct Entry {
+    std::string path;
+    int fd;
+    uint64_t lastUsed;
+  };
+
+  std::vector<Entry> entries;
+  size_t capacity;
+  uint64_t clock = 0;
+  uint64_t rootGeneration = 0;
+  std::mutex mutex;
+
+  Entry *find(const char *path) {
+    for (Entry &e : entries) {
+      if (e.path == path)
+        return &e;
+    }
+    return nullptr;
+  }
+
+  static int open_counted(const char *path) {
+    uint64_t start = monotonic_ns();
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    count_syscall(start);
+    return fd;
+  }
+
+  Entry *open_entry(const char *path) {
+    int fd = open_counted(path);
+    if (fd < 0)
+      return nullptr;
+    if (entries.size() >= capacity) {
+      Entry *oldest = &entries[0];
+      for (Entry &e : entries) {
+        if (e.lastUsed < oldest->lastUsed)
+          oldest = &e;
+      }
+      close(oldest->fd);
+      oldest->path = path;
+      oldest->fd = fd;
+      return oldest;
+    }
+    entries.push_back(Entry{path, fd, 0});
+    return &entries.back();
+  }
+
+  void drop(Entry &entry) {
+    if (entry.fd >= 0)
+      close(entry.fd);
+    if (&entry != &entries.back())
+      entry = std::move(entries.back());
+    entries.pop_back();
+  }
+};
+
+/**
+ * @brief Reads a whole procfs/sysfs file into a reusable buffer through the
+ * shared ProcFileCache.
+ * @param path The file to read, as on the live system; the sysroot is
+ * prepended here.
+ * @param buffer Output buffer, resized to the number of bytes read.
+ * @return True on success, false if the file could not be opened or read.
+ */
+inline bool read_proc_file(const char *path, std::string &buffer) {
+  static thread_local std::string rooted;
+  return ProcFileCache::instance().read(sys_path(path, rooted), buffer);
+}
+
+/**
+ * @brief Skips spaces and tabs (but not newlines).
+ */
+inline const char *skip_blanks(const char *p, const char *end) {
+  while (p < end && (*p == ' ' || *p == '\t'))
+    ++p;
+  return p;
+}
+
+/**
+ * @brief Moves to the first character after the next newline.
+ */
+inline const char *next_line(const char *p, const char *end) {
+  while (p < end && *p != '\n')
+    ++p;
+  return p < end ? p + 1 : end;
+}
+
+/**
+ * @brief Parses an unsigned decimal integer, skipping leading blanks.
+ * @param p Cursor, advanced past the number.
+ * @return The parsed value, or 0 if no digits were found.
+ */
+inline long long scan_ll(const char *&p, const char *end) {
+  p = skip_blanks(p, end);
+  long long value = 0;
+  while (p < end && *p >= '0' && *p <= '9') {
+    value = value * 10 + (*p - '0');
+    ++p;
+  }
+  return value;
+}
+
+/**
+ * @brief Finds a "Key: value" line (as in /proc/meminfo) and parses its
+ * integer value.
+ * @param key The key including the colon, e.g. "MemTotal:".
+ * @return The value, or -1 if the key was not found.
+ */
+inline long long find_key_ll(const std::string &buffer, const char *key) {
+  size_t key_len = std::char_traits<char>::length(key);
+  const char *p = buffer.data();
+  const char *end = p + buffer.size();
+  while (p < end) {
+    if (static_cast<size_t>(end - p) > key_len &&
+        buffer.compare(static_cast<size_t>(p - buffer.data()), key_len, key) ==
+            0) {
+      p += key_len;
+      return scan_ll(p, end);
+    }
+    p = next_line(p, end);
+  }
+  return -1;
+}
+
+} // namespace LiveView
+
+#endif // __linux__
+#endif // PROC_READER_HPP
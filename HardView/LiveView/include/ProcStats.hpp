@@ -0,0 +1,316 @@
+/*
+================================================================================
+ MIT License
+
+ Copyright (c) 2025 gafoo
+
+ This file is part of the HardView project:
+ https://github.com/gafoo173/HardView
+
+ Licensed under the MIT License.
+ See the LICENSE file in the project root for more details.
+================================================================================
+*/
+// ===================================================================================
+// ProcStats.hpp: Allocation-free parsers for /proc/diskstats and /proc/net/dev.
+//
+// Counters are stored in a DeviceTable: a flat array where each device keeps
+// the same index from one parse to the next, next to its previous counters.
+// Rates are computed index by index, so once the read buffer and the table
+// have grown to their working size, sampling does not allocate.
+// ===================================================================================
+#ifndef PROC_STATS_HPP
+#define PROC_STATS_HPP
+#pragma once
+
+#ifdef __linux__
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "ProcReader.hpp"
+
+namespace LiveView {
+
+/**
+ * @brief Counters of one /proc/diskstats line (see the kernel's
+ * Documentation/admin-guide/iostats.rst). Times are in milliseconds.
+ */
+struct DiskStats {
+  long long reads;           // Reads completed
+  long long reads_merged;    // Adjacent reads merged into one request
+  long long sectors_read;    // 512-byte sectors read
+  long long read_ms;         // Time spent on reads
+  long long writes;          // Writes completed
+  long long writes_merged;   // Adjacent writes merged into one request
+  long long sectors_written; // 512-byte sectors written
+  long long write_ms;        // Time spent on writes
+  long long in_flight;       // I/Os currently in progress (not a counter)
+  long long io_ms;           // Time the device had I/O in progress
+  long long weighted_io_ms;  // io_ms weighted by the number of I/Os
+  bool whole_disk;           // Listed in /sys/block, i.e. not a partition
+  bool physical;  // Whole disk backed by hardware (has /sys/block/X/device),
+                  // as opposed to loop, dm, md, zram... devices
+};
+
+struct NetworkStats {
+  long long bytes_received;
+  long long packets_received;
+  long long errors_received;
+  long long drops_received;
+  long long bytes_transmitted;
+  long long packets_transmitted;
+  long long errors_transmitted;
+  long long drops_transmitted;
+};
+
+/**
+ * @brief Flat table of per-device counters keyed by a stable device index.
+ *
+ * Call begin_update() before each parse and update() for every device found.
+ * A device keeps its index for as long as it keeps showing up, and devices
+ * missing from a parse are dropped at the next begin_update(). membership()
+ * changes whenever a device is added or dropped, i.e. whenever indices
+ * resolved by name may be stale.
+ */
+template <typename T> class DeviceTable {
+public:
+  struct Entry {
+    char name[32];    // NUL-terminated, truncated if longer
+    T value;          // Counters from the latest parse
+    T previous;       // Counters from the parse before it
+    bool present;     // Seen in the latest parse
+    bool hasPrevious; // Seen in the parse before it, `previous` is valid
+  };
+
+  /**
+   * @brief Moves the latest counters to `previous` and starts a new parse.
+   */
+  void begin_update() {
+    size_t kept = 0;
+    for (size_t i = 0; i < count; ++i) {
+      Entry &e = entries[i];
+      if (!e.present) {
+        ++changes; // Device disappeared
+        continue;
+      }
+      e.previous = e.value;
+      e.hasPrevious = true;
+      e.present = false;
+      if (kept != i)
+        entries[kept] = e;
+      ++kept;
+    }
+    count = kept;
+    cursor = 0;
+  }
+
+  /**
+   * @brief Finds or adds a device and marks it as present.
+   * @param name Device name (not necessarily NUL-terminated).
+   * @param len Length of the name.
+   * @param created Optional output, set to true if the device is new.
+   * @return The counters to fill in for this parse. Fields not written by the
+   * parser keep their value, so per-device properties can be set once.
+   */
+  T &update(const char *name, size_t len, bool *created = nullptr) {
+    if (len >= sizeof(Entry::name))
+      len = sizeof(Entry::name) - 1;
+    // Devices are listed in the same order every time, so the slot after the
+    // previous match is almost always the right one.
+    size_t index = count;
+    if (cursor < count && matches(entries[cursor], name, len)) {
+      index = cursor;
+    } else {
+      for (size_t i = 0; i < count; ++i) {
+        if (matches(entries[i], name, len)) {
+          index = i;
+          break;
+        }
+      }
+    }
+    if (created)
+      *created = index == count;
+    if (index == count) {
+      if (count == entries.size())
+        entries.emplace_back();
+      Entry &e = entries[count++];
+      std::memcpy(e.name, name, len);
+      e.name[len] = '\0';
+      e.value = T{};
+      e.previous = T{};
+      e.hasPrevious = false;
+      ++changes;
+    }
+    cursor = index + 1;
+    entries[index].present = true;
+    return entries[index].value;
+  }
+
+  size_t size() const { return count; }
+  const Entry &operator[](size_t index) const { return entries[index]; }
+
+  /**
+   * @brief Counter of devices added and dropped so far.
+   */
+  uint64_t membership() const { return changes; }
+
+private:
+  std::vector<Entry> entries;
+  size_t count = 0;  // Entries in use; `entries` only ever grows
+  size_t cursor = 0; // Expected index of the next device
+  uint64_t changes = 0;
+
+  static bool matches(const Entry &e, const char *name, size_t len) {
+    return std::memcmp(e.name, name, len) == 0 && e.name[len] == '\0';
+  }
+};
+
+/**
+ * @brief Reads the next whitespace-delimited token.
+ * @param p Cursor, advanced past the token.
+ * @param len Output token length.
+ * @return Pointer to the first character of the token.
+ */
+inline const char *scan_token(const char *&p, const char *end, size_t &len) {
+  p = skip_blanks(p, end);
+  const char *start = p;
+  while (p < end && *p != ' ' && *p != '\t' && *p != '\n')
+    ++p;
+  len = static_cast<size_t>(p - start);
+  return start;
+}
+
+/**
+ * @brief Sets DiskStats::whole_disk and DiskStats::physical from sysfs.
+ * Called once per device, when it first shows up.
+ */
+inline void classify_block_device(const char *name, size_t len,
+                                  DiskStats &stats) {
+  std::string path = sys_path(std::string("/sys/block/"));
+  for (size_t i = 0; i < len; ++i) // "cciss/c0d0" is "cciss!c0d0" in sysfs
+    path += name[i] == '/' ? '!' : name[i];
+  stats.whole_disk = access(path.c_str(), F_OK) == 0;
+  path += "/device";
+  stats.physical = stats.whole_disk && access(path.c_str(), F_OK) == 0;
+}
+
+/**
+ * @brief Parses the content of /proc/diskstats into a device table.
+ * Partitions are kept in the table (so they are classified only once) with
+ * whole_disk unset.
+ * @param table Table to update; table.begin_update() is done here.
+ */
+inline void parse_disk_stats(const char *p, const char *end,
+                             DeviceTable<DiskStats> &table) {
+  table.begin_update();
+  while (p < end) {
+    scan_ll(p, end); // major
+    scan_ll(p, end); // minor
+    size_t len;
+    const char *name = scan_token(p, end, len);
+    if (len > 0) {
+      bool created;
+      DiskStats &s = table.update(name, len, &created);
+      if (created)
+        classify_block_device(name, len, s);
+      s.reads = scan_ll(p, end);
+      s.reads_merged = scan_ll(p, end);
+      s.sectors_read = scan_ll(p, end);
+      s.read_ms = scan_ll(p, end);
+      s.writes = scan_ll(p, end);
+      s.writes_merged = scan_ll(p, end);
+      s.sectors_written = scan_ll(p, end);
+      s.write_ms = scan_ll(p, end);
+      s.in_flight = scan_ll(p, end);
+      s.io_ms = scan_ll(p, end);
+      s.weighted_io_ms = scan_ll(p, end);
+    }
+    p = next_line(p, end);
+  }
+}
+
+/**
+ * @brief Reads and parses /proc/diskstats into a device table.
+ * @param buffer Reusable read buffer.
+ * @param table Table to update; table.begin_update() is done here.
+ */
+inline void get_disk_stats(std::string &buffer, DeviceTable<DiskStats> &table) {
+  CollectorTimer timer(COLLECTOR_DISK);
+  if (!read_proc_file("/proc/diskstats", buffer))
+    throw std::runtime_error("Failed to open /proc/diskstats.");
+  parse_disk_stats(buffer.data(), buffer.data() + buffer.size(), table);
+}
+
+/**
+ * @brief Parses the content of /proc/net/dev into an interface table,
+ * skipping loopback.
+ * @param table Table to update; table.begin_update() is done here.
+ */
+inline void parse_network_stats(const char *p, const char *end,
+                                DeviceTable<NetworkStats> &table) {
+  table.begin_update();
+  p = next_line(p, end); // Skip header line 1
+  p = next_line(p, end); // Skip header line 2
+  while (p < end) {
+    p = skip_blanks(p, end);
+    const char *name = p;
+    while (p < end && *p != ':' && *p != '\n')
+      ++p;
+    if (p == end || *p != ':') {
+      p = next_line(p, end);
+      continue;
+    }
+    size_t len = static_cast<size_t>(p - name);
+    ++p; // ':' (counters may follow without a space)
+    if (len == 2 && name[0] == 'l' && name[1] == 'o') { // Skip loopback
+      p = next_line(p, end);
+      continue;
+    }
+    NetworkStats &s = table.update(name, len);
+    // Receive: bytes packets errs drop fifo frame compressed multicast
+    s.bytes_received = scan_ll(p, end);
+    s.packets_received = scan_ll(p, end);
+    s.errors_received = scan_ll(p, end);
+    s.drops_received = scan_ll(p, end);
+    for (int i = 0; i < 4; ++i)
+      scan_ll(p, end);
+    // Transmit: bytes packets errs drop fifo colls carrier compressed
+    s.bytes_transmitted = scan_ll(p, end);
+    s.packets_transmitted = scan_ll(p, end);
+    s.errors_transmitted = scan_ll(p, end);
+    s.drops_transmitted = scan_ll(p, end);
+    p = next_line(p, end);
+  }
+}
+
+/**
+ * @brief Reads and parses /proc/net/dev into an interface table.
+ * @param buffer Reusable read buffer.
+ * @param table Table to update; table.begin_update() is done here.
+ */
+inline void get_network_stats(std::string &buffer,
+                              DeviceTable<NetworkStats> &table) {
+  if (!read_proc_file("/proc/net/dev", buffer))
+    throw std::runtime_error("Failed to open /proc/net/dev.");
+  parse_network_stats(buffer.data(), buffer.data() + buffer.size(), table);
+}
+
+/**
+ * @brief Bytes received plus transmitted by one interface between the last
+ * two parses (0 for an interface seen for the first time).
+ */
+inline long long
+network_bytes_delta(const DeviceTable<NetworkStats>::Entry &e) {
+  if (!e.present || !e.hasPrevious)
+    return 0;
+  return (e.value.bytes_received - e.previous.bytes_received) +
+         (e.value.bytes_transmitted - e.previous.bytes_transmitted);
+}
+
+} // namespace LiveView
+
+#endif // __linux__
+#endif // PROC_STATS_HPP
@@ -0,0 +1,569 @@
+/*
+================================================================================
+ MIT License
+
+ Copyright (c) 2025 gafoo
+
+ This file is part of the HardView project:
+ https://github.com/gafoo173/HardView
+
+ Licensed under the MIT License.
+ See the LICENSE file in the project root for more details.
+================================================================================
+*/
+// ===================================================================================
+// Recording.hpp: Append-only binary recordings of raw LiveView counters (Linux).
+//
+// A recording stores what the sampler read, not what it computed: the
+// /proc/stat CPU times, MemTotal/MemAvailable, the /proc/diskstats counters
+// of every whole disk, the per-interface network counters and, optionally,
+// every hwmon sensor value, each frame stamped with the monotonic and the
+// wall-clock time. Replaying a recording through the normal rate functions
+// gives back the samples of the original run, at any speed.
+//
+// File layout (host byte order, i.e. little-endian on x86 and ARM):
+//   header   "HVRECORD", uint32 version, uint32 reserved
+//   frame*   uint32 size (bytes after this field), uint32 sections,
+//            int64 timestamp_ns, int64 wall_time_ns, then one block per bit
+//            set in `sections`, in bit order:
+//     RECORD_CPU            8 x int64: user nice system idle iowait irq
+//                           softirq steal
+//     RECORD_MEMORY         int64 total_bytes, int64 available_bytes
+//     RECORD_DISK           uint32 count, count x (uint8 name length, name,
+//                           11 x int64 counters, uint8 flags)
+//     RECORD_NETWORK        uint32 count, count x (uint8 name length, name,
+//                           8 x int64 counters)
+//     RECORD_SENSOR_LABELS  uint32 count, count x (3 x (uint16 length,
+//                           bytes): label, chip, type); only written when
+//                           the sensor list changed
+//     RECORD_SENSORS        uint32 count, count x double value
+// Every frame is written with a single append, and a reader stops at a
+// truncated last frame, so a recording cut by a crash stays readable. A
+// writer that reopens such a file cuts the torn frame off before appending.
+// ===================================================================================
+#ifndef RECORDING_HPP
+#define RECORDING_HPP
+#pragma once
+
+#ifdef __linux__
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "ProcStats.hpp"
+
+namespace LiveView {
+
+/**
+ * @brief Frame sections (RecordedFrame::sections bits).
+ */
+enum RecordSection : uint32_t {
+  RECORD_CPU = 1,
+  RECORD_MEMORY = 2,
+  RECORD_DISK = 4,
+  RECORD_NETWORK = 8,
+  RECORD_SENSOR_LABELS = 16,
+  RECORD_SENSORS = 32,
+};
+
+constexpr uint32_t RECORDING_VERSION = 1;
+
+/**
+ * @brief The raw counters of one sampler pass.
+ */
+struct RecordedFrame {
+  int64_t timestamp_ns = 0; // Monotonic (steady_clock) timestamp
+  int64_t wall_time_ns = 0; // Wall-clock (system_clock) timestamp
+  uint32_t sections = 0;    // RecordSection bits of the blocks below
+  long long cpu[8] = {};    // /proc/stat "cpu" line, in file order
+  long long mem_total_bytes = 0;
+  long long mem_available_bytes = 0;
+  std::vector<std::pair<std::string, DiskStats>> disks; // Whole disks only
+  std::vector<std::pair<std::string, NetworkStats>> networks;
+  // Sensors, in SensorSession::labels() order. The label, chip and type
+  // lists keep their value from frame to frame until the list changes.
+  std::vector<std::string> sensor_labels;
+  std::vector<std::string> sensor_chips;
+  std::vector<std::string> sensor_types;
+  std::vector<double> sensor_values;
+};
+
+namespace detail {
+
+inline void put_raw(std::string &out, const void *data, size_t size) {
+  out.append(static_cast<const char *>(data), size);
+}
+
+template <typename T> inline void put(std::string &out, T value) {
+  put_raw(out, &value, sizeof(value));
+}
+
+inline void put_name(std::string &out, const std::string &name) {
+  uint8_t len = static_cast<uint8_t>(name.size() < 255 ? name.size() : 255);
+  put(out, len);
+  put_raw(out, name.data(), len);
+}
+
+inline void put_string16(std::string &out, const std::string &s) {
+  uint16_t len =
+      static_cast<uint16_t>(s.size() < 65535 ? s.size() : 65535);
+  put(out, len);
+  put_raw(out, s.data(), len);
+}
+
+/**
+ * @brief Bounds-checked cursor over one frame.
+ */
+struct FrameCursor {
+  const char *p;
+  const char *end;
+
+  template <typename T> T get() {
+    T value;
+    if (static_cast<size_t>(end - p) < sizeof(T))
+      throw std::runtime_error("Corrupt recording: frame too short.");
+    std::memcpy(&value, p, sizeof(T));
+    p += sizeof(T);
+    return value;
+  }
+
+  /**
+   * @brief Reads an element count, checked against the bytes left (each
+   * element takes at least `minSize` bytes), so a corrupt count cannot
+   * cause a huge allocation.
+   */
+  size_t get_count(size_t minSize) {
+    uint32_t count = get<uint32_t>();
+    if (count > static_cast<size_t>(end - p) / minSize)
+      throw std::runtime_error("Corrupt recording: frame too short.");
+    return count;
+  }
+
+  std::string get_bytes(size_t len) {
+    if (static_cast<size_t>(end - p) < len)
+      throw std::runtime_error("Corrupt recording: frame too short.");
+    std::string s(p, len);
+    p += len;
+    return s;
+  }
+};
+
+inline bool write_all(int fd, const char *data, size_t size) {
+  while (size > 0) {
+    ssize_t n = ::write(fd, data, size);
+    if (n < 0) {
+      if (errno == EINTR)
+        continue;
+      return false;
+    }
+    data += n;
+    size -= static_cast<size_t>(n);
+  }
+  return true;
+}
+
+/**
+ * @return Bytes read; less than size only at end of file.
+ */
+inline size_t read_all(int fd, char *data, size_t size) {
+  size_t used = 0;
+  while (used < size) {
+    ssize_t n = ::read(fd, data + used, size - used);
+    if (n < 0) {
+      if (errno == EINTR)
+        continue;
+      throw std::runtime_error(std::string("Failed to read recording: ") +
+                               std::strerror(errno));
+    }
+    if (n == 0)
+      break;
+    used += static_cast<size_t>(n);
+  }
+  return used;
+}
+
+constexpr char RECORDING_MAGIC[8] = {'H', 'V', 'R', 'E', 'C', 'O', 'R', 'D'};
+constexpr size_t RECORDING_HEADER_SIZE = 16;
+// Bytes of a frame before its sections (sections, timestamp, wall time)
+constexpr uint32_t RECORDING_FRAME_MIN_SIZE = 20;
+// Larger size fields can only come from a corrupt file
+constexpr uint32_t RECORDING_FRAME_MAX_SIZE = 16 << 20;
+
+/**
+ * @brief Offset just past the last complete frame of a recording that is
+ * `fileSize` bytes long: the end of the file, unless the last frame was
+ * cut while being written (or its size field is corrupt).
+ */
+inline off_t complete_frames_end(int fd, off_t fileSize) {
+  off_t offset = static_cast<off_t>(RECORDING_HEADER_SIZE);
+  while (fileSize - offset >= static_cast<off_t>(sizeof(uint32_t))) {
+    uint32_t size;
+    if (::pread(fd, &size, sizeof(size), offset) !=
+        static_cast<ssize_t>(sizeof(size)))
+      break;
+    if (size < RECORDING_FRAME_MIN_SIZE || size > RECORDING_FRAME_MAX_SIZE ||
+        fileSize - offset - static_cast<off_t>(sizeof(size)) < size)
+      break;
+    offset += static_cast<off_t>(sizeof(size)) + size;
+  }
+  return offset;
+}
+
+} // namespace detail
+
+/**
+ * @class RecordingWriter
+ * @brief Appends frames to a recording file, creating it if needed.
+ * Not thread-safe; the sampler writes from its collector thread only.
+ */
+class RecordingWriter {
+public:
+  /**
+   * @param path File to create or append to. An existing file must be a
+   * recording of the same version; a frame cut by a crash at its end is
+   * removed first, so the new frames stay readable.
+   * @throws std::runtime_error If the file cannot be opened or is not a
+   * recording.
+   */
+  explicit RecordingWriter(const std::string &path) {
+    fd = open(path.c_str(), O_RDWR | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+    if (fd < 0)
+      throw std::runtime_error("Failed to open recording " + path + ": " +
+                               std::strerror(errno));
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+      std::string header;
+      detail::put_raw(header, detail::RECORDING_MAGIC, 8);
+      detail::put(header, RECORDING_VERSION);
+      detail::put(header, uint32_t{0});
+      if (!detail::write_all(fd, header.data(), header.size())) {
+        close(fd);
+        throw std::runtime_error("Failed to write recording " + path + ".");
+      }
+    } else {
+      char header[detail::RECORDING_HEADER_SIZE];
+      uint32_t version = 0;
+      bool valid = pread(fd, header, sizeof(header), 0) ==
+                       static_cast<ssize_t>(sizeof(header)) &&
+                   std::memcmp(header, detail::RECORDING_MAGIC, 8) == 0;
+      if (valid)
+        std::memcpy(&version, header + 8, sizeof(version));
+      if (!valid || version != RECORDING_VERSION) {
+        close(fd);
+        throw std::runtime_error(path +
+                                 " exists and is not a version " +
+                                 std::to_string(RECORDING_VERSION) +
+                                 " LiveView recording.");
+      }
+      off_t end = detail::complete_frames_end(fd, st.st_size);
+      if (end < st.st_size && ftruncate(fd, end) != 0) {
+        int err = errno;
+        close(fd);
+        throw std::runtime_error("Failed to repair recording " + path + ": " +
+                                 std::strerror(err));
+      }
+    }
+  }
+
+  ~RecordingWriter() {
+    if (fd >= 0)
+      close(fd);
+  }
+
+  RecordingWriter(const RecordingWriter &) = delete;
+  RecordingWriter &operator=(const RecordingWriter &) = delete;
+
+  /**
+   * @brief Appends one frame. The sensor labels are only stored when they
+   * differ from the previous frame written by this writer.
+   * @throws std::runtime_error If the write fails (e.g. disk full). The
+   * partly written frame is cut off again, so later frames stay readable;
+   * if that fails too, every later write throws.
+   */
+  void write(const RecordedFrame &frame) {
+    if (broken)
+      throw std::runtime_error(
+          "Recording stopped: a failed write could not be undone.");
+    uint32_t sections = frame.sections & ~uint32_t{RECORD_SENSOR_LABELS};
+    if ((sections & RECORD_SENSORS) &&
+        (frame.sensor_labels != labels || frame.sensor_chips != chips ||
+         frame.sensor_types != types)) {
+      sections |= RECORD_SENSOR_LABELS;
+      labels = frame.sensor_labels;
+      chips = frame.sensor_chips;
+      types = frame.sensor_types;
+    }
+
+    buffer.clear();
+    detail::put(buffer, uint32_t{0}); // Size, patched below
+    detail::put(buffer, sections);
+    detail::put(buffer, frame.timestamp_ns);
+    detail::put(buffer, frame.wall_time_ns);
+    if (sections & RECORD_CPU) {
+      for (long long v : frame.cpu)
+        detail::put(buffer, static_cast<int64_t>(v));
+    }
+    if (sections & RECORD_MEMORY) {
+      detail::put(buffer, static_cast<int64_t>(frame.mem_total_bytes));
+      detail::put(buffer, static_cast<int64_t>(frame.mem_available_bytes));
+    }
+    if (sections & RECORD_DISK) {
+      detail::put(buffer, static_cast<uint32_t>(frame.disks.size()));
+      for (const auto &d : frame.disks) {
+        const DiskStats &s = d.second;
+        detail::put_name(buffer, d.first);
+        for (long long v :
+             {s.reads, s.reads_merged, s.sectors_read, s.read_ms, s.writes,
+              s.writes_merged, s.sectors_written, s.write_ms, s.in_flight,
+              s.io_ms, s.weighted_io_ms})
+          detail::put(buffer, static_cast<int64_t>(v));
+        detail::put(buffer, static_cast<uint8_t>((s.whole_disk ? 1 : 0) |
+                                                 (s.physical ? 2 : 0)));
+      }
+    }
+    if (sections & RECORD_NETWORK) {
+      detail::put(buffer, static_cast<uint32_t>(frame.networks.size()));
+      for (const auto &n : frame.networks) {
+        const NetworkStats &s = n.second;
+        detail::put_name(buffer, n.first);
+        for (long long v :
+             {s.bytes_received, s.packets_received, s.errors_received,
+              s.drops_received, s.bytes_transmitted, s.packets_transmitted,
+              s.errors_transmitted, s.drops_transmitted})
+          detail::put(buffer, static_cast<int64_t>(v));
+      }
+    }
+    if (sections & RECORD_SENSOR_LABELS) {
+      detail::put(buffer, static_cast<uint32_t>(labels.size()));
+      for (size_t i = 0; i < labels.size(); ++i) {
+        detail::put_string16(buffer, labels[i]);
+        detail::put_string16(buffer, i < chips.size() ? chips[i] : "");
+        detail::put_string16(buffer, i < types.size() ? types[i] : "");
+      }
+    }
+    if (sections & RECORD_SENSORS) {
+      detail::put(buffer, static_cast<uint32_t>(frame.sensor_values.size()));
+      for (double v : frame.sensor_values)
+        detail::put(buffer, v);
+    }
+    if (buffer.size() - sizeof(uint32_t) > detail::RECORDING_FRAME_MAX_SIZE)
+      throw std::runtime_error("Recording frame too large.");
+    uint32_t size = static_cast<uint32_t>(buffer.size() - sizeof(uint32_t));
+    std::memcpy(&buffer[0], &size, sizeof(size));
+    off_t start = lseek(fd, 0, SEEK_END);
+    if (start < 0 || !detail::write_all(fd, buffer.data(), buffer.size())) {
+      int err = errno;
+      // A torn frame would make the reader misparse every frame after it
+      if (start < 0 || ftruncate(fd, start) != 0)
+        broken = true;
+      // The labels may not have reached the file: store them again
+      labels.clear();
+      chips.clear();
+      types.clear();
+      throw std::runtime_error(std::string("Failed to write recording: ") +
+                               std::strerror(err));
+    }
+    ++frames;
+  }
+
+  /**
+   * @brief Frames written by this writer.
+   */
+  uint64_t frame_count() const { return frames; }
+
+private:
+  int fd = -1;
+  std::string buffer; // Reused frame encoding buffer
+  std::vector<std::string> labels, chips, types;
+  uint64_t frames = 0;
+  bool broken = false; // A torn frame is left in the file
+};
+
+/**
+ * @class RecordingReader
+ * @brief Reads the frames of a recording in order.
+ */
+class RecordingReader {
+public:
+  /**
+   * @throws std::runtime_error If the file cannot be opened or is not a
+   * recording of a supported version.
+   */
+  explicit RecordingReader(const std::string &path) : path(path) {
+    fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+      throw std::runtime_error("Failed to open recording " + path + ": " +
+                               std::strerror(errno));
+    char header[detail::RECORDING_HEADER_SIZE];
+    uint32_t version = 0;
+    bool valid = detail::read_all(fd, header, sizeof(header)) ==
+                     sizeof(header) &&
+                 std::memcmp(header, detail::RECORDING_MAGIC, 8) == 0;
+    if (valid)
+      std::memcpy(&version, header + 8, sizeof(version));
+    if (!valid || version != RECORDING_VERSION) {
+      close(fd);
+      throw std::runtime_error(path + " is not a version " +
+                               std::to_string(RECORDING_VERSION) +
+                               " LiveView recording.");
+    }
+  }
+
+  ~RecordingReader() {
+    if (fd >= 0)
+      close(fd);
+  }
+
+  RecordingReader(const RecordingReader &) = delete;
+  RecordingReader &operator=(const RecordingReader &) = delete;
+
+  /**
+   * @brief Reads the next frame.
+   * @param frame Output; sections missing from the frame keep their value,
+   * and the sensor lists are kept until a frame changes them.
+   * @return False at the end of the recording (or at a truncated last frame).
+   * @throws std::runtime_error On a read error or a corrupt frame.
+   */
+  bool next(RecordedFrame &frame) {
+    uint32_t size;
+    if (detail::read_all(fd, reinterpret_cast<char *>(&size), sizeof(size)) <
+        sizeof(size))
+      return false;
+    if (size < detail::RECORDING_FRAME_MIN_SIZE ||
+        size > detail::RECORDING_FRAME_MAX_SIZE)
+      throw std::runtime_error("Corrupt recording: invalid frame size.");
+    buffer.resize(size);
+    if (detail::read_all(fd, &buffer[0], size) < size)
+      return false; // Cut while being written
+
+    detail::FrameCursor c{buffer.data(), buffer.data() + buffer.size()};
+    frame.sections = c.get<uint32_t>();
+    frame.timestamp_ns = c.get<int64_t>();
+    frame.wall_time_ns = c.get<int64_t>();
+    if (frame.sections & RECORD_CPU) {
+      for (long long &v : frame.cpu)
+        v = c.get<int64_t>();
+    }
+    if (frame.sections & RECORD_MEMORY) {
+      frame.mem_total_bytes = c.get<int64_t>();
+      frame.mem_available_bytes = c.get<int64_t>();
+    }
+    if (frame.sections & RECORD_DISK) {
+      frame.disks.resize(c.get_count(1 + 11 * 8 + 1));
+      for (auto &d : frame.disks) {
+        d.first = c.get_bytes(c.get<uint8_t>());
+        DiskStats &s = d.second;
+        for (long long *v :
+             {&s.reads, &s.reads_merged, &s.sectors_read, &s.read_ms,
+              &s.writes, &s.writes_merged, &s.sectors_written, &s.write_ms,
+              &s.in_flight, &s.io_ms, &s.weighted_io_ms})
+          *v = c.get<int64_t>();
+        uint8_t flags = c.get<uint8_t>();
+        s.whole_disk = (flags & 1) != 0;
+        s.physical = (flags & 2) != 0;
+      }
+    }
+    if (frame.sections & RECORD_NETWORK) {
+      frame.networks.resize(c.get_count(1 + 8 * 8));
+      for (auto &n : frame.networks) {
+        n.first = c.get_bytes(c.get<uint8_t>());
+        NetworkStats &s = n.second;
+        for (long long *v :
+             {&s.bytes_received, &s.packets_received, &s.errors_received,
+              &s.drops_received, &s.bytes_transmitted, &s.packets_transmitted,
+              &s.errors_transmitted, &s.drops_transmitted})
+          *v = c.get<int64_t>();
+      }
+    }
+    if (frame.sections & RECORD_SENSOR_LABELS) {
+      size_t count = c.get_count(3 * 2);
+      frame.sensor_labels.resize(count);
+      frame.sensor_chips.resize(count);
+      frame.sensor_types.resize(count);
+      for (size_t i = 0; i < count; ++i) {
+        frame.sensor_labels[i] = c.get_bytes(c.get<uint16_t>());
+        frame.sensor_chips[i] = c.get_bytes(c.get<uint16_t>());
+        frame.sensor_types[i] = c.get_bytes(c.get<uint16_t>());
+      }
+    }
+    if (frame.sections & RECORD_SENSORS) {
+      frame.sensor_values.resize(c.get_count(sizeof(double)));
+      for (double &v : frame.sensor_values)
+        v = c.get<double>();
+    }
+    ++frames;
+    return true;
+  }
+
+  /**
+   * @brief Goes back to the first frame.
+   */
+  void rewind() {
+    if (lseek(fd, static_cast<off_t>(detail::RECORDING_HEADER_SIZE),
+              SEEK_SET) < 0)
+      throw std::runtime_error("Failed to rewind recording " + path + ".");
+    frames = 0;
+  }
+
+  /**
+   * @brief Frames read since the start (or the last rewind()).
+   */
+  uint64_t frame_count() const { return frames; }
+
+private:
+  int fd = -1;
+  std::string path;
+  std::string buffer; // Reused frame buffer
+  uint64_t frames = 0;
+};
+
+/**
+ * @brief Copies the whole disks of a disk table into a frame.
+ */
+inline void record_disks(const DeviceTable<DiskStats> &table,
+                         RecordedFrame &frame) {
+  frame.disks.clear();
+  for (size_t i = 0; i < table.size(); ++i) {
+    const auto &e = table[i];
+    if (e.present && e.value.whole_disk)
+      frame.disks.emplace_back(e.name, e.value);
+  }
+  frame.sections |= RECORD_DISK;
+}
+
+/**
+ * @brief Copies the interfaces of a network table into a frame.
+ */
+inline void record_networks(const DeviceTable<NetworkStats> &table,
+                            RecordedFrame &frame) {
+  frame.networks.clear();
+  for (size_t i = 0; i < table.size(); ++i) {
+    const auto &e = table[i];
+    if (e.present)
+      frame.networks.emplace_back(e.name, e.value);
+  }
+  frame.sections |= RECORD_NETWORK;
+}
+
+/**
+ * @brief Feeds the devices of a frame into a table, as a parse would.
+ */
+template <typename T>
+inline void replay_devices(const std::vector<std::pair<std::string, T>> &devices,
+                           DeviceTable<T> &table) {
+  table.begin_update();
+  for (const auto &d : devices)
+    table.update(d.first.data(), d.first.size()) = d.second;
+}
+
+} // namespace LiveView
+
+#endif // __linux__
+#endif // RECORDING_HPP
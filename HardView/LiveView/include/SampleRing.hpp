@@ -0,0 +1,182 @@
+/*
+================================================================================
+ MIT License
+
+ Copyright (c) 2025 gafoo
+
+ This file is part of the HardView project:
+ https://github.com/gafoo173/HardView
+
+ Licensed under the MIT License.
+ See the LICENSE file in the project root for more details.
+================================================================================
+*/
+// ===================================================================================
+// SampleRing.hpp: Fixed-capacity lock-free ring buffer for LiveView samples.
+//
+// One producer thread pushes samples; any number of reader threads can read
+// the latest sample or a window of history at the same time. Every slot is
+// guarded by its own sequence number (a per-slot seqlock), so the producer
+// never waits for readers and readers never block the producer: a reader
+// that races with an overwrite simply skips that slot.
+//
+// A ring can also carry a fixed number of extra double values per sample
+// (per-core or per-device figures, whose count is only known at run time).
+// They are stored in one flat array next to the slots and guarded by the
+// same per-slot sequence number as the sample itself.
+// ===================================================================================
+#ifndef SAMPLE_RING_HPP
+#define SAMPLE_RING_HPP
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace LiveView {
+
+template <typename T> class SampleRing {
+  static_assert(std::is_trivially_copyable<T>::value,
+                "SampleRing requires a trivially copyable sample type.");
+
+  struct Slot {
+    // 0 = empty, odd = being written, 2 * index + 2 = holds sample #index
+    std::atomic<uint64_t> seq{0};
+    T data;
+  };
+
+  std::unique_ptr<Slot[]> slots;
+  size_t capacity;
+  std::atomic<uint64_t> head{0}; // Total number of pushed samples
+  std::unique_ptr<double[]> columns; // capacity * width extra values
+  size_t width = 0;
+
+  /**
+   * @brief Copies sample #index (and its extra values into `row`, if not
+   * null) if it is still present in the ring.
+   */
+  bool read_index(uint64_t index, T &out, double *row = nullptr) const {
+    const Slot &slot = slots[index % capacity];
+    uint64_t before = slot.seq.load(std::memory_order_acquire);
+    if (before != 2 * index + 2)
+      return false; // Not written yet or already overwritten
+    out = slot.data;
+    if (row) {
+      const double *src = &columns[(index % capacity) * width];
+      for (size_t i = 0; i < width; ++i)
+        row[i] = src[i];
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return slot.seq.load(std::memory_order_relaxed) == before;
+  }
+
+public:
+  /**
+   * @brief Creates a ring able to hold the last `capacity` samples.
+   */
+  explicit SampleRing(size_t capacity)
+      : slots(new Slot[capacity ? capacity : 1]),
+        capacity(capacity ? capacity : 1) {}
+
+  SampleRing(const SampleRing &) = delete;
+  SampleRing &operator=(const SampleRing &) = delete;
+
+  /**
+   * @brief Gives every sample `count` extra values. The layout is fixed for
+   * the life of the ring, so it can only be set before the first push().
+   * @throws std::logic_error If samples were already pushed.
+   */
+  void set_width(size_t count) {
+    if (head.load(std::memory_order_acquire) != 0)
+      throw std::logic_error("SampleRing width set after the first push.");
+    columns.reset(count ? new double[capacity * count]() : nullptr);
+    width = count;
+  }
+
+  /**
+   * @brief Number of extra values per sample.
+   */
+  size_t row_width() const { return width; }
+
+  /**
+   * @brief Appends a sample, overwriting the oldest one when full.
+   * Must only be called from a single producer thread.
+   * @param row row_width() extra values; null stores zeros.
+   */
+  void push(const T &value, const double *row = nullptr) {
+    uint64_t index = head.load(std::memory_order_relaxed);
+    Slot &slot = slots[index % capacity];
+    slot.seq.store(2 * index + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.data = value;
+    double *dst = width ? &columns[(index % capacity) * width] : nullptr;
+    for (size_t i = 0; i < width; ++i)
+      dst[i] = row ? row[i] : 0.0;
+    slot.seq.store(2 * index + 2, std::memory_order_release);
+    head.store(index + 1, std::memory_order_release);
+  }
+
+  /**
+   * @brief Copies the most recent sample.
+   * @return False if no sample has been pushed yet.
+   */
+  bool latest(T &out) const {
+    for (;;) {
+      uint64_t count = head.load(std::memory_order_acquire);
+      if (count == 0)
+        return false;
+      if (read_index(count - 1, out))
+        return true;
+      // The producer lapped us while copying; retry with the new head.
+    }
+  }
+
+  /**
+   * @brief Copies up to `max_count` of the most recent samples, oldest first.
+   * Samples overwritten while being copied are skipped.
+   * @param out Output vector; cleared first, its capacity is reused.
+   * @param rows Optional output of the extra values, row_width() per copied
+   * sample, in the same order.
+   * @return The number of samples copied.
+   */
+  size_t history(std::vector<T> &out, size_t max_count,
+                 std::vector<double> *rows = nullptr) const {
+    out.clear();
+    if (rows)
+      rows->clear();
+    uint64_t count = head.load(std::memory_order_acquire);
+    if (count == 0)
+      return 0; // The width is only stable once a sample was pushed
+    uint64_t window = max_count < capacity ? max_count : capacity;
+    uint64_t first = count > window ? count - window : 0;
+    out.reserve(static_cast<size_t>(count - first));
+    if (rows)
+      rows->resize(static_cast<size_t>(count - first) * width);
+    T value;
+    for (uint64_t i = first; i < count; ++i) {
+      double *row = rows && width ? rows->data() + out.size() * width : nullptr;
+      if (read_index(i, value, row))
+        out.push_back(value);
+    }
+    if (rows)
+      rows->resize(out.size() * width);
+    return out.size();
+  }
+
+  /**
+   * @brief Total number of samples pushed since creation.
+   */
+  uint64_t total() const { return head.load(std::memory_order_acquire); }
+
+  /**
+   * @brief Maximum number of samples kept in the ring.
+   */
+  size_t size() const { return capacity; }
+};
+
+} // namespace LiveView
+
+#endif // SAMPLE_RING_HPP
@@ -0,0 +1,443 @@
+/*
+================================================================================
+ MIT License
+
+ Copyright (c) 2025 gafoo
+
+ This file is part of the HardView project:
+ https://github.com/gafoo173/HardView
+
+ Licensed under the MIT License.
+ See the LICENSE file in the project root for more details.
+================================================================================
+*/
+// ===================================================================================
+// SensorSession.hpp: Process-wide sensor sessions (Linux).
+//
+// A session scans its backend once into a flat table of sensor features:
+// libsensors (initialized once, chips/features walked once) or the hwmon
+// sysfs files directly (see HwmonSensors.hpp). A SensorQuery matches labels
+// against that table the first time it is read and keeps the result, so
+// later reads are a few sensors_get_value() calls or pread()s with no init,
+// scan, string matching or cleanup. libsensors keeps global state and is not
+// thread-safe; every call into it goes through the session's mutex.
+// libsensors always reads the live system, so while a sysroot is set (see
+// ProcReader.hpp) the automatic session is the hwmon one, which rescans
+// whenever the sysroot changes.
+// ===================================================================================
+#ifndef SENSOR_SESSION_HPP
+#define SENSOR_SESSION_HPP
+#pragma once
+
+#ifdef __linux__
+#include <cstdint>
+#include <cstdlib>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "CollectorStats.hpp"
+#include "HwmonSensors.hpp"
+
+// libsensors is optional: without its headers only the hwmon backend is built,
+// and with them the library is loaded at runtime if it is installed.
+#if !defined(HV_NO_LIBSENSORS) && defined(__has_include)
+#if __has_include(<sensors/sensors.h>)
+#include <dlfcn.h>
+#include <sensors/sensors.h>
+#define HV_HAVE_LIBSENSORS 1
+#endif
+#endif
+
+namespace LiveView {
+
+class SensorSession;
+
+/**
+ * @class SensorQuery
+ * @brief Describes which sensor labels to read, and caches the features that
+ * matched in the current session.
+ *
+ * A label matches if it is equal to one of `exact`, or equal to or contains
+ * one of `keywords`. Reading returns the value of the first matching feature
+ * that can be read and is not -1.
+ */
+class SensorQuery {
+public:
+  explicit SensorQuery(std::vector<std::string> keywords,
+                       std::vector<std::string> exact = {})
+      : keywords(std::move(keywords)), exact(std::move(exact)) {}
+
+  /**
+   * @brief Query for one sensor label, as done by GetSensorByName().
+   * @param exactMatch True for an exact label match, false for a substring.
+   */
+  static SensorQuery by_name(const std::string &name, bool exactMatch) {
+    return exactMatch ? SensorQuery({}, {name}) : SensorQuery({name});
+  }
+
+private:
+  friend class SensorSession;
+
+  std::vector<std::string> keywords;
+  std::vector<std::string> exact;
+  std::vector<size_t> candidates; // Feature indexes in the session
+  const SensorSession *session = nullptr; // Session `candidates` is for
+  uint64_t generation = 0;                // ... and its generation
+
+  bool matches(const std::string &label) const {
+    for (const auto &key : exact) {
+      if (label == key)
+        return true;
+    }
+    for (const auto &key : keywords) {
+      if (label.find(key) != std::string::npos)
+        return true;
+    }
+    return false;
+  }
+};
+
+/**
+ * @brief One sensor value returned by SensorSession::read_all().
+ */
+struct SensorReading {
+  std::string label; // Same label as in SensorSession::labels()
+  double value;      // -1 if the sensor could not be read
+  std::string chip;  // Driver/chip name, e.g. "coretemp" or "nct6775"
+  const char *type;  // "temp", "fan", "in", "power", ... (static string)
+};
+
+/**
+ * @brief Backends for SensorSession.
+ */
+enum SensorBackend : int {
+  SENSOR_BACKEND_AUTO = 0,       // libsensors if it can be loaded, else hwmon
+  SENSOR_BACKEND_LIBSENSORS = 1, // libsensors only
+  SENSOR_BACKEND_HWMON = 2,      // /sys/class/hwmon only
+};
+
+#ifdef HV_HAVE_LIBSENSORS
+/**
+ * @brief libsensors entry points, loaded with dlopen() so that the library
+ * is only needed at runtime when the libsensors backend is used.
+ */
+struct LibSensors {
+  decltype(&::sensors_init) init = nullptr;
+  decltype(&::sensors_cleanup) cleanup = nullptr;
+  decltype(&::sensors_get_detected_chips) get_detected_chips = nullptr;
+  decltype(&::sensors_get_features) get_features = nullptr;
+  decltype(&::sensors_get_all_subfeatures) get_all_subfeatures = nullptr;
+  decltype(&::sensors_get_label) get_label = nullptr;
+  decltype(&::sensors_get_value) get_value = nullptr;
+
+  /**
+   * @brief The loaded library, or nullptr if it is not installed.
+   */
+  static const LibSensors *get() {
+    static const LibSensors *lib = load();
+    return lib;
+  }
+
+private:
+  static const LibSensors *load() {
+    void *handle = nullptr;
+    for (const char *name :
+         {"libsensors.so.5", "libsensors.so.4", "libsensors.so"}) {
+      if ((handle = dlopen(name, RTLD_NOW | RTLD_LOCAL)) != nullptr)
+        break;
+    }
+    if (!handle)
+      return nullptr;
+    // Never unloaded, like the session that uses it.
+    auto *lib = new LibSensors();
+    bool ok = bind(handle, "sensors_init", lib->init) &&
+              bind(handle, "sensors_cleanup", lib->cleanup) &&
+              bind(handle, "sensors_get_detected_chips",
+                   lib->get_detected_chips) &&
+              bind(handle, "sensors_get_features", lib->get_features) &&
+              bind(handle, "sensors_get_all_subfeatures",
+                   lib->get_all_subfeatures) &&
+              bind(handle, "sensors_get_label", lib->get_label) &&
+              bind(handle, "sensors_get_value", lib->get_value);
+    if (!ok) {
+      delete lib;
+      dlclose(handle);
+      return nullptr;
+    }
+    return lib;
+  }
+
+  template <typename F>
+  static bool bind(void *handle, const char *name, F &function) {
+    function = reinterpret_cast<F>(dlsym(handle, name));
+    return function != nullptr;
+  }
+};
+#endif // HV_HAVE_LIBSENSORS
+
+/**
+ * @class SensorSession
+ * @brief Long-lived sensor session shared by all LiveView sensor readers,
+ * one per backend. All methods are thread-safe.
+ */
+class SensorSession {
+public:
+  SensorSession(const SensorSession &) = delete;
+  SensorSession &operator=(const SensorSession &) = delete;
+
+  ~SensorSession() { close_hwmon_features(hwmon); }
+
+  /**
+   * @brief The process-wide session of a backend.
+   * @param backend SENSOR_BACKEND_AUTO picks libsensors when it is installed
+   * and initializes and no sysroot is set, and the hwmon reader otherwise.
+   * @throws std::invalid_argument For an unknown backend.
+   */
+  static SensorSession &instance(int backend = SENSOR_BACKEND_AUTO) {
+    if (backend != SENSOR_BACKEND_AUTO &&
+        backend != SENSOR_BACKEND_LIBSENSORS && backend != SENSOR_BACKEND_HWMON)
+      throw std::invalid_argument(
+          "Invalid sensor backend. Use SENSOR_BACKEND_AUTO, "
+          "SENSOR_BACKEND_LIBSENSORS or SENSOR_BACKEND_HWMON.");
+    // Never destroyed: libsensors is left initialized until the process
+    // exits, and collector threads still running during static destruction
+    // keep a valid session.
+    static SensorSession *libsensors =
+        new SensorSession(SENSOR_BACKEND_LIBSENSORS);
+    static SensorSession *hwmon = new SensorSession(SENSOR_BACKEND_HWMON);
+    if (backend == SENSOR_BACKEND_LIBSENSORS)
+      return *libsensors;
+    if (backend == SENSOR_BACKEND_HWMON || !get_sys_root().empty())
+      return *hwmon;
+    static SensorSession *automatic =
+        libsensors->try_load() ? libsensors : hwmon;
+    return *automatic;
+  }
+
+  /**
+   * @brief Reads a query, resolving it first if it was never resolved in the
+   * current session generation.
+   * @return The sensor value, or -1.0 if no matching sensor could be read.
+   * @throws std::runtime_error If the backend cannot be initialized.
+   */
+  double read(SensorQuery &query) {
+    CollectorTimer timer(COLLECTOR_SENSORS);
+    std::lock_guard<std::mutex> lock(mutex);
+    ensure_loaded();
+    if (query.session != this || query.generation != generation) {
+      query.candidates.clear();
+      for (size_t i = 0; i < features.size(); ++i) {
+        if (query.matches(features[i].label))
+          query.candidates.push_back(i);
+      }
+      query.session = this;
+      query.generation = generation;
+    }
+    for (size_t index : query.candidates) {
+      double value;
+      if (read_value(index, value) && value != -1.0)
+        return value;
+    }
+    return -1.0;
+  }
+
+  /**
+   * @brief Labels of every feature, in libsensors' chip and feature order.
+   * @throws std::runtime_error If the backend cannot be initialized.
+   */
+  std::vector<std::string> labels() {
+    std::lock_guard<std::mutex> lock(mutex);
+    ensure_loaded();
+    std::vector<std::string> result;
+    result.reserve(features.size());
+    for (const Feature &f : features)
+      result.push_back(f.label);
+    return result;
+  }
+
+  /**
+   * @brief Reads every sensor in one pass over the feature table.
+   * @param out Output vector, cleared first; one entry per label, in the
+   * order of labels().
+   * @throws std::runtime_error If the backend cannot be initialized.
+   */
+  void read_all(std::vector<SensorReading> &out) {
+    CollectorTimer timer(COLLECTOR_SENSORS);
+    std::lock_guard<std::mutex> lock(mutex);
+    ensure_loaded();
+    out.clear();
+    out.reserve(features.size());
+    for (size_t i = 0; i < features.size(); ++i) {
+      const Feature &f = features[i];
+      double value;
+      if (!read_value(i, value))
+        value = -1.0;
+      out.push_back(SensorReading{f.label, value, f.chip, f.type});
+    }
+  }
+
+  /**
+   * @brief Rescans the chips, e.g. after a hwmon driver was loaded.
+   * Queries are resolved again on their next read.
+   * @throws std::runtime_error If the backend cannot be initialized.
+   */
+  void reload() {
+    CollectorTimer timer(COLLECTOR_SENSORS);
+    std::lock_guard<std::mutex> lock(mutex);
+    unload();
+    ensure_loaded();
+  }
+
+  /**
+   * @brief The backend of this session: "libsensors" or "hwmon".
+   */
+  const char *backend() const {
+    return kind == SENSOR_BACKEND_HWMON ? "hwmon" : "libsensors";
+  }
+
+private:
+  struct Feature {
+    std::string label;
+    std::string chip;
+    const char *type;
+  };
+
+#ifdef HV_HAVE_LIBSENSORS
+  struct ChipFeature {
+    const sensors_chip_name *chip; // Valid until sensors_cleanup()
+    int input;                     // First readable subfeature, -1 if none
+  };
+  std::vector<ChipFeature> chipFeatures; // libsensors backend
+#endif
+  std::vector<HwmonFeature> hwmon; // hwmon backend
+  std::vector<Feature> features; // Parallel to chipFeatures or hwmon
+
+  int kind;
+  std::mutex mutex;
+  bool loaded = false;
+  uint64_t generation = 0;
+  uint64_t rootGeneration = 0; // sys_root_generation() of the hwmon scan
+
+  explicit SensorSession(int kind) : kind(kind) {}
+
+  static const char *feature_type_name(int type) {
+    switch (type) { // enum sensors_feature_type
+    case 0x00: return "in";
+    case 0x01: return "fan";
+    case 0x02: return "temp";
+    case 0x03: return "power";
+    case 0x04: return "energy";
+    case 0x05: return "curr";
+    case 0x06: return "humidity";
+    case 0x10: return "vid";
+    case 0x11: return "intrusion";
+    case 0x18: return "beep_enable";
+    default: return "unknown";
+    }
+  }
+
+  bool try_load() {
+    std::lock_guard<std::mutex> lock(mutex);
+    try {
+      ensure_loaded();
+      return true;
+    } catch (const std::runtime_error &) {
+      return false;
+    }
+  }
+
+  bool read_value(size_t index, double &value) {
+    if (kind == SENSOR_BACKEND_HWMON) {
+      const HwmonFeature &f = hwmon[index];
+      return f.fd >= 0 && read_hwmon_value(f.fd, f.scale, value);
+    }
+#ifdef HV_HAVE_LIBSENSORS
+    const ChipFeature &f = chipFeatures[index];
+    return f.input >= 0 &&
+           LibSensors::get()->get_value(f.chip, f.input, &value) == 0;
+#else
+    return false;
+#endif
+  }
+
+  void unload() {
+    if (!loaded)
+      return;
+    features.clear();
+    close_hwmon_features(hwmon);
+#ifdef HV_HAVE_LIBSENSORS
+    if (kind == SENSOR_BACKEND_LIBSENSORS) {
+      chipFeatures.clear();
+      LibSensors::get()->cleanup();
+    }
+#endif
+    loaded = false;
+  }
+
+  void ensure_loaded() {
+    if (loaded && kind == SENSOR_BACKEND_HWMON &&
+        rootGeneration != sys_root_generation())
+      unload();
+    if (loaded)
+      return;
+    if (kind == SENSOR_BACKEND_HWMON) {
+      rootGeneration = sys_root_generation();
+      hwmon = scan_hwmon();
+      for (const HwmonFeature &f : hwmon)
+        features.push_back(
+            Feature{f.label, f.chip, hwmon_feature_types()[f.type].prefix});
+    } else {
+      load_libsensors();
+    }
+    loaded = true;
+    ++generation;
+  }
+
+  void load_libsensors() {
+#ifdef HV_HAVE_LIBSENSORS
+    const LibSensors *lib = LibSensors::get();
+    if (!lib)
+      throw std::runtime_error("libsensors is not installed.");
+    if (lib->init(nullptr) != 0)
+      throw std::runtime_error("Failed to initialize sensors.");
+
+    const sensors_chip_name *chip;
+    int chip_nr = 0;
+    while ((chip = lib->get_detected_chips(nullptr, &chip_nr)) != nullptr) {
+      const sensors_feature *feature;
+      int feature_nr = 0;
+      while ((feature = lib->get_features(chip, &feature_nr)) != nullptr) {
+        char *label = lib->get_label(chip, feature);
+        if (!label)
+          continue;
+        features.push_back(Feature{label, chip->prefix ? chip->prefix : "",
+                                   feature_type_name(feature->type)});
+        std::free(label); // Allocated by libsensors
+
+        ChipFeature f{chip, -1};
+        const sensors_subfeature *sub;
+        int sub_nr = 0;
+        while ((sub = lib->get_all_subfeatures(chip, feature, &sub_nr)) !=
+               nullptr) {
+          if (sub->flags & SENSORS_MODE_R) {
+            f.input = sub->number;
+            break;
+          }
+        }
+        chipFeatures.push_back(f);
+      }
+    }
+#else
+    throw std::runtime_error(
+        "LiveView was built without libsensors support.");
+#endif
+  }
+};
+
+} // namespace LiveView
+
+#endif // __linux__
+#endif // SENSOR_SESSION_HPP
@@ -0,0 +1,310 @@
+/*
+================================================================================
+ MIT License
+
+ Copyright (c) 2025 gafoo
+
+ This file is part of the HardView project:
+ https://github.com/gafoo173/HardView
+
+ Licensed under the MIT License.
+ See the LICENSE file in the project root for more details.
+================================================================================
+*/
+// ===================================================================================
+// SharedMetrics.hpp: The latest sampler values in a POSIX shared-memory
+// segment, for readers in other processes (Linux).
+//
+// One process (the publisher) collects and writes every sample into the
+// segment; any number of processes map it read-only and copy the latest
+// sample with no system call and no lock. The sample is guarded by a
+// seqlock: the publisher makes `seq` odd, writes, then makes it even again,
+// and a reader retries its copy if `seq` was odd or changed meanwhile.
+// Readers never delay the publisher.
+//
+// This header only depends on the C++ standard library and POSIX, so a
+// reader can include it alone. Segment layout (host byte order, offsets in
+// bytes; readers in other languages can map /dev/shm/<name> directly):
+//   0   char[8]  magic "HVSHMET\0"
+//   8   uint32   version (SHARED_METRICS_VERSION)
+//   12  uint32   size of the segment
+//   16  int32    publisher pid (0 once the publisher stopped)
+//   20  uint32   reserved
+//   24  uint64   seq: odd while the sample is being written
+//   32  int64    timestamp_ns (CLOCK_MONOTONIC), int64 wall_time_ns,
+//               8 x double: interval_ms, cpu_usage, ram_usage,
+//               ram_used_bytes, ram_total_bytes, disk_read_MBps,
+//               disk_write_MBps, net_MBps,
+//               uint64 sample_count (0: nothing published yet), error_count
+// ===================================================================================
+#ifndef SHARED_METRICS_HPP
+#define SHARED_METRICS_HPP
+#pragma once
+
+#ifdef __linux__
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include <fcntl.h>
+#include <sched.h>
+#include <signal.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace LiveView {
+
+constexpr uint32_t SHARED_METRICS_VERSION = 1;
+constexpr const char *SHARED_METRICS_DEFAULT_NAME = "/hardview";
+
+/**
+ * @brief The published values: one LiveSample plus the sampler counters.
+ */
+struct SharedSample {
+  int64_t timestamp_ns;
+  int64_t wall_time_ns;
+  double interval_ms;
+  double cpu_usage;
+  double ram_usage;
+  double ram_used_bytes;
+  double ram_total_bytes;
+  double disk_read_MBps;
+  double disk_write_MBps;
+  double net_MBps;
+  uint64_t sample_count;
+  uint64_t error_count;
+};
+
+struct SharedMetricsSegment {
+  char magic[8];
+  uint32_t version;
+  uint32_t size;
+  std::atomic<int32_t> publisher_pid;
+  uint32_t reserved;
+  std::atomic<uint64_t> seq;
+  SharedSample sample;
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free &&
+                  std::atomic<int32_t>::is_always_lock_free,
+              "The shared segment needs lock-free (address-free) atomics.");
+static_assert(offsetof(SharedMetricsSegment, seq) == 24 &&
+                  offsetof(SharedMetricsSegment, sample) == 32 &&
+                  sizeof(SharedMetricsSegment) == 128,
+              "SharedMetricsSegment layout changed; bump the version.");
+
+namespace detail {
+constexpr char SHARED_METRICS_MAGIC[8] = {'H', 'V', 'S', 'H', 'M', 'E', 'T', 0};
+
+/**
+ * @brief Checks a shm name: "/name" with no other '/'. A missing leading
+ * '/' is added.
+ */
+inline std::string shared_metrics_name(const std::string &name) {
+  std::string result = name.empty() || name[0] != '/' ? "/" + name : name;
+  if (result.size() < 2 || result.size() > 255 ||
+      result.find('/', 1) != std::string::npos)
+    throw std::invalid_argument("Invalid shared memory name: " + name);
+  return result;
+}
+} // namespace detail
+
+/**
+ * @class SharedMetricsWriter
+ * @brief Creates the segment and publishes samples into it. Only one writer
+ * per name can exist at a time (across processes).
+ */
+class SharedMetricsWriter {
+  std::string name;
+  int fd = -1;
+  SharedMetricsSegment *segment = nullptr;
+
+public:
+  /**
+   * @brief Creates (or takes over) the segment.
+   * @param segmentName Segment name, e.g. "/hardview" (/dev/shm/hardview).
+   * @param mode Permissions of a new segment; readable by everyone by
+   * default.
+   * @throws std::runtime_error If the segment cannot be created or another
+   * process is publishing under the same name.
+   */
+  explicit SharedMetricsWriter(const std::string &segmentName,
+                               mode_t mode = 0644)
+      : name(detail::shared_metrics_name(segmentName)) {
+    fd = ::shm_open(name.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, mode);
+    if (fd < 0)
+      throw std::runtime_error("Failed to create shared memory " + name +
+                               ": " + std::strerror(errno));
+    // Released by the kernel if this process dies, so a crashed publisher
+    // does not block the next one.
+    if (::flock(fd, LOCK_EX | LOCK_NB) != 0) {
+      ::close(fd);
+      throw std::runtime_error("Shared memory " + name +
+                               " is already published by another process.");
+    }
+    if (::ftruncate(fd, sizeof(SharedMetricsSegment)) != 0) {
+      int err = errno;
+      ::close(fd);
+      throw std::runtime_error("Failed to size shared memory " + name + ": " +
+                               std::strerror(err));
+    }
+    void *p = ::mmap(nullptr, sizeof(SharedMetricsSegment),
+                     PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (p == MAP_FAILED) {
+      int err = errno;
+      ::close(fd);
+      throw std::runtime_error("Failed to map shared memory " + name + ": " +
+                               std::strerror(err));
+    }
+    segment = static_cast<SharedMetricsSegment *>(p);
+
+    // A segment left by a previous publisher keeps its seq, so readers that
+    // still map it never see it go backwards.
+    uint64_t odd = segment->seq.load(std::memory_order_relaxed) | 1;
+    segment->seq.store(odd, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    segment->version = SHARED_METRICS_VERSION;
+    segment->size = sizeof(SharedMetricsSegment);
+    segment->reserved = 0;
+    std::memset(&segment->sample, 0, sizeof(SharedSample));
+    std::memcpy(segment->magic, detail::SHARED_METRICS_MAGIC, 8);
+    segment->publisher_pid.store(static_cast<int32_t>(::getpid()),
+                                 std::memory_order_relaxed);
+    segment->seq.store(odd + 1, std::memory_order_release);
+  }
+
+  /**
+   * @brief Marks the segment as stopped and removes its name; readers that
+   * still map it keep the last sample.
+   */
+  ~SharedMetricsWriter() {
+    segment->publisher_pid.store(0, std::memory_order_release);
+    ::munmap(segment, sizeof(SharedMetricsSegment));
+    ::shm_unlink(name.c_str());
+    ::close(fd); // Releases the lock
+  }
+
+  SharedMetricsWriter(const SharedMetricsWriter &) = delete;
+  SharedMetricsWriter &operator=(const SharedMetricsWriter &) = delete;
+
+  /**
+   * @brief Publishes a sample. Never blocks.
+   */
+  void publish(const SharedSample &sample) {
+    uint64_t seq = segment->seq.load(std::memory_order_relaxed);
+    segment->seq.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    segment->sample = sample;
+    segment->seq.store(seq + 2, std::memory_order_release);
+  }
+
+  const std::string &get_name() const { return name; }
+};
+
+/**
+ * @class SharedMetricsReader
+ * @brief Maps a published segment read-only and copies its latest sample.
+ */
+class SharedMetricsReader {
+  std::string name;
+  const SharedMetricsSegment *segment = nullptr;
+
+public:
+  /**
+   * @brief Maps the segment.
+   * @param segmentName Name given to the publisher.
+   * @throws std::runtime_error If no publisher created it, or it was made by
+   * an incompatible HardView version.
+   */
+  explicit SharedMetricsReader(
+      const std::string &segmentName = SHARED_METRICS_DEFAULT_NAME)
+      : name(detail::shared_metrics_name(segmentName)) {
+    int fd = ::shm_open(name.c_str(), O_RDONLY | O_CLOEXEC, 0);
+    if (fd < 0)
+      throw std::runtime_error("Failed to open shared memory " + name + ": " +
+                               std::strerror(errno));
+    struct stat st;
+    void *p = MAP_FAILED;
+    if (::fstat(fd, &st) == 0 &&
+        st.st_size >= static_cast<off_t>(sizeof(SharedMetricsSegment)))
+      p = ::mmap(nullptr, sizeof(SharedMetricsSegment), PROT_READ, MAP_SHARED,
+                 fd, 0);
+    ::close(fd); // The mapping stays valid
+    if (p == MAP_FAILED)
+      throw std::runtime_error("Shared memory " + name +
+                               " is not a HardView metrics segment.");
+    segment = static_cast<const SharedMetricsSegment *>(p);
+    if (std::memcmp(segment->magic, detail::SHARED_METRICS_MAGIC, 8) != 0 ||
+        segment->version != SHARED_METRICS_VERSION) {
+      ::munmap(const_cast<SharedMetricsSegment *>(segment),
+               sizeof(SharedMetricsSegment));
+      throw std::runtime_error("Shared memory " + name +
+                               " is not a version " +
+                               std::to_string(SHARED_METRICS_VERSION) +
+                               " HardView metrics segment.");
+    }
+  }
+
+  ~SharedMetricsReader() {
+    ::munmap(const_cast<SharedMetricsSegment *>(segment),
+             sizeof(SharedMetricsSegment));
+  }
+
+  SharedMetricsReader(const SharedMetricsReader &) = delete;
+  SharedMetricsReader &operator=(const SharedMetricsReader &) = delete;
+
+  /**
+   * @brief Copies a consistent snapshot of the latest sample.
+   * @return false if nothing was published yet.
+   * @throws std::runtime_error If the publisher died while writing.
+   */
+  bool read(SharedSample &out) const {
+    for (unsigned attempt = 0;; ++attempt) {
+      if (attempt >= 64) {
+        // The publisher was preempted in the middle of a write, or died
+        if (!publisher_alive())
+          throw std::runtime_error("The publisher of " + name +
+                                   " stopped in the middle of a write.");
+        ::sched_yield();
+      }
+      uint64_t before = segment->seq.load(std::memory_order_acquire);
+      if (before & 1)
+        continue;
+      out = segment->sample;
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (segment->seq.load(std::memory_order_relaxed) == before)
+        return out.sample_count != 0;
+    }
+  }
+
+  /**
+   * @brief Pid of the publishing process, 0 if it stopped cleanly. A
+   * reader keeps the segment it mapped; to follow a new publisher under the
+   * same name, create a new reader.
+   */
+  int publisher_pid() const {
+    return segment->publisher_pid.load(std::memory_order_acquire);
+  }
+
+  /**
+   * @brief Whether the publisher is still running (it may have crashed
+   * without clearing its pid).
+   */
+  bool publisher_alive() const {
+    int pid = publisher_pid();
+    return pid > 0 && (::kill(pid, 0) == 0 || errno == EPERM);
+  }
+
+  const std::string &get_name() const { return name; }
+};
+
+} // namespace LiveView
+
+#endif // __linux__
+#endif // SHARED_METRICS_HPP
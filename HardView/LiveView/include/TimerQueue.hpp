@@ -0,0 +1,164 @@
+/*
+================================================================================
+ MIT License
+
+ Copyright (c) 2025 gafoo
+
+ This file is part of the HardView project:
+ https://github.com/gafoo173/HardView
+
+ Licensed under the MIT License.
+ See the LICENSE file in the project root for more details.
+================================================================================
+*/
+// ===================================================================================
+// TimerQueue.hpp: One background thread that runs callbacks at a deadline.
+//
+// The async collectors take their first snapshot on the calling thread and
+// schedule the second one here instead of sleeping, so any number of
+// concurrent interval measurements share this single thread. Tasks are kept
+// in a min-heap ordered by deadline (ties in scheduling order); the thread
+// sleeps until the earliest one is due. Tasks run one after the other on
+// the timer thread and should be short: they take a snapshot and hand the
+// result back.
+// ===================================================================================
+#ifndef TIMER_QUEUE_HPP
+#define TIMER_QUEUE_HPP
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace LiveView {
+
+class TimerQueue {
+public:
+  using Clock = std::chrono::steady_clock;
+  using Task = std::function<void()>;
+
+private:
+  struct Entry {
+    Clock::time_point due;
+    uint64_t order;
+    Task task;
+  };
+  struct Later {
+    bool operator()(const Entry &a, const Entry &b) const {
+      return a.due != b.due ? a.due > b.due : a.order > b.order;
+    }
+  };
+
+  std::priority_queue<Entry, std::vector<Entry>, Later> entries;
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::thread worker;
+  uint64_t nextOrder = 0;
+  bool stopped = false;
+
+  void run() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (!stopped) {
+      if (entries.empty()) {
+        cv.wait(lock);
+        continue;
+      }
+      Clock::time_point due = entries.top().due;
+      if (Clock::now() < due) {
+        cv.wait_until(lock, due);
+        continue;
+      }
+      Task task = std::move(const_cast<Entry &>(entries.top()).task);
+      entries.pop();
+      lock.unlock();
+      try {
+        task();
+      } catch (...) {
+        // Tasks report their own errors; never let one stop the thread
+      }
+      task = nullptr; // Released outside the lock
+      lock.lock();
+    }
+  }
+
+  TimerQueue() = default;
+
+public:
+  /**
+   * @brief The process-wide queue. Its thread starts with the first task.
+   */
+  static TimerQueue &instance() {
+    // Leaked: tasks may still be pending when static destructors run
+    static TimerQueue *queue = new TimerQueue();
+    return *queue;
+  }
+
+  TimerQueue(const TimerQueue &) = delete;
+  TimerQueue &operator=(const TimerQueue &) = delete;
+
+  /**
+   * @brief Runs `task` on the timer thread once `due` has passed.
+   * @throws std::runtime_error After shutdown().
+   */
+  void schedule(Clock::time_point due, Task task) {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (stopped)
+        throw std::runtime_error("The timer thread has been shut down.");
+      if (!worker.joinable())
+        worker = std::thread(&TimerQueue::run, this);
+      entries.push(Entry{due, nextOrder++, std::move(task)});
+    }
+    cv.notify_one();
+  }
+
+  /**
+   * @brief Runs `task` on the timer thread in `delay_ms` milliseconds.
+   */
+  void schedule_after(int delay_ms, Task task) {
+    schedule(Clock::now() + std::chrono::milliseconds(delay_ms),
+             std::move(task));
+  }
+
+  /**
+   * @brief Number of tasks waiting for their deadline.
+   */
+  size_t pending() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries.size();
+  }
+
+  /**
+   * @brief Stops the thread for good (waiting for a running task) and
+   * returns the tasks that never ran, so the caller decides where they are
+   * destroyed.
+   */
+  std::vector<Task> shutdown() {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      stopped = true;
+    }
+    cv.notify_all();
+    if (worker.joinable())
+      worker.join();
+    std::vector<Task> dropped;
+    std::lock_guard<std::mutex> lock(mutex);
+    dropped.reserve(entries.size());
+    while (!entries.empty()) {
+      dropped.push_back(std::move(const_cast<Entry &>(entries.top()).task));
+      entries.pop();
+    }
+    return dropped;
+  }
+};
+
+} // namespace LiveView
+
+#endif // TIMER_QUEUE_HPP
@@ -17,7 +17,8 @@ here; their PascalCase/camelCase C++-style aliases are intentionally
 omitted from this stub.
 """
 
-from typing import List, Tuple, Union, Dict
+import asyncio
+from typing import Callable, List, Optional, Tuple, Union, Dict
 
 # ------------------------------------------------------------------
 # PyLiveCPU
@@ -31,6 +32,25 @@ class PyLiveCPU:
         """Returns total CPU usage percentage (0-100), sampled over interval_ms."""
         ...
 
+    def get_usage_delta(self) -> Tuple[float, float]:
+        """Returns (usage, elapsed_ms) since the previous call without sleeping.
+        The first call only stores a snapshot and returns (0.0, 0.0).
+        """
+        ...
+
+    def get_usage_async(self, interval_ms: int) -> "asyncio.Future[float]":
+        """(Linux-only) Awaitable get_usage(). Must be called from a running
+        event loop; the measurement finishes on a shared timer thread.
+        """
+        ...
+
+    def get_per_core_usage(self) -> List[float]:
+        """(Linux-only) Per-core utilisation since the previous call, as a
+        flat list of 6 values per core: user, system, iowait, irq, softirq
+        and steal percentages. The first call returns zeros.
+        """
+        ...
+
     def cpuid(self) -> List[Tuple[str, str]]:
         """Returns CPU information using the CPUID instruction, as a list of
         (name, value) pairs.
@@ -59,6 +79,55 @@ class PyLiveCPU:
         ...
 
 
+# ------------------------------------------------------------------
+# PyLiveCPUFreq
+# ------------------------------------------------------------------
+class PyLiveCPUFreq:
+    """(Linux-only) Per-core clock speed from cpufreq, plus the effective
+    frequency from the APERF/MPERF counters where /dev/cpu/N/msr is readable.
+    """
+
+    def __init__(self) -> None: ...
+
+    def get_frequencies(self, interval: int = 1000) -> List["CoreFrequency"]:
+        """Frequency of every online core; effective_MHz covers the interval."""
+        ...
+
+    def get_frequencies_delta(self) -> Tuple[List["CoreFrequency"], float]:
+        """Returns (cores, elapsed_ms) since the previous call without
+        sleeping. effective_MHz is -1 on the first call.
+        """
+        ...
+
+    def get_base_frequency(self) -> float:
+        """Base frequency in MHz from CPUID leaf 0x16 (0 if not reported)."""
+        ...
+
+    def get_max_frequency(self) -> float:
+        """Maximum frequency in MHz from CPUID leaf 0x16 (0 if not reported)."""
+        ...
+
+    def get_bus_frequency(self) -> float:
+        """Bus frequency in MHz from CPUID leaf 0x16 (0 if not reported)."""
+        ...
+
+    def has_effective_frequency(self) -> bool:
+        """True if the last sweep could read the APERF/MPERF counters (root
+        and the msr module).
+        """
+        ...
+
+
+class CoreFrequency:
+    """(Linux-only) Clock speed of one core; unreadable values are -1."""
+
+    cpu: int
+    cur_MHz: float
+    min_MHz: float
+    max_MHz: float
+    effective_MHz: float
+
+
 # ------------------------------------------------------------------
 # PyLiveRam
 # ------------------------------------------------------------------
@@ -95,18 +164,74 @@ class PyLiveDisk:
         """
         ...
 
+    def get_usage_delta(
+        self,
+    ) -> Tuple[Union[float, List[Tuple[str, float]]], float]:
+        """Returns (usage, elapsed_ms) since the previous call without
+        sleeping; usage has the same format as get_usage().
+        """
+        ...
+
+    def get_usage_async(
+        self, interval: int = 1000
+    ) -> "asyncio.Future[List[Tuple[str, float]]]":
+        """(Linux-only) Awaitable get_usage(): resolves to
+        [("Read MB/s", value), ("Write MB/s", value)] over the measured
+        interval. Must be called from a running event loop.
+        """
+        ...
+
+    def get_device_stats(self, interval: int = 1000) -> List["DiskDeviceStats"]:
+        """(Linux-only) Per-device IOPS, merged ops, MB/s, await, queue size
+        and % busy for every whole disk in /sys/block (NVMe, md, dm and loop
+        devices included, partitions excluded).
+        """
+        ...
+
+    def get_device_stats_delta(self) -> Tuple[List["DiskDeviceStats"], float]:
+        """(Linux-only) Returns (devices, elapsed_ms) since the previous call
+        without sleeping. The first call returns zero rates.
+        """
+        ...
+
     def high_disk_usage(self, threshold_mbps: float = 80.0) -> bool:
         """(Mode 1 only) True if read or write speed exceeds threshold_mbps."""
         ...
 
 
+class DiskDeviceStats:
+    """(Linux-only) Block I/O metrics of one whole disk over one interval."""
+
+    name: str
+    read_iops: float
+    write_iops: float
+    read_merged_per_sec: float
+    write_merged_per_sec: float
+    read_MBps: float
+    write_MBps: float
+    read_await_ms: float
+    write_await_ms: float
+    avg_queue_size: float
+    in_flight: int
+    busy_percent: float
+
+
 # ------------------------------------------------------------------
 # PyLiveNetwork
 # ------------------------------------------------------------------
+NET_BACKEND_AUTO: int
+NET_BACKEND_NETLINK: int
+NET_BACKEND_PROCFS: int
+
+
 class PyLiveNetwork:
     """Provides network I/O monitoring functionalities."""
 
-    def __init__(self) -> None: ...
+    def __init__(self, backend: int = 0) -> None:
+        """backend (Linux-only): NET_BACKEND_AUTO (rtnetlink, falling back to
+        /proc/net/dev), NET_BACKEND_NETLINK or NET_BACKEND_PROCFS.
+        """
+        ...
 
     def get_usage(
         self, interval: int = 1000, mode: int = 0
@@ -116,12 +241,422 @@ class PyLiveNetwork:
         """
         ...
 
+    def get_usage_delta(
+        self, mode: int = 0
+    ) -> Tuple[Union[float, List[Tuple[str, float]]], float]:
+        """Returns (usage, elapsed_ms) since the previous call without
+        sleeping; usage has the same format as get_usage(mode=mode).
+        """
+        ...
+
+    def get_usage_async(
+        self, interval: int = 1000, mode: int = 0
+    ) -> "asyncio.Future[Union[float, List[Tuple[str, float]]]]":
+        """(Linux-only) Awaitable get_usage(): same format as
+        get_usage(mode=mode), over the measured interval. Must be called from
+        a running event loop.
+        """
+        ...
+
     def get_high_card(self) -> str:
         """Returns the name of the network interface with the highest usage,
         or 'N/A' if none available.
         """
         ...
 
+    def get_interface_stats(
+        self, interval: int = 1000
+    ) -> List["NetInterfaceStats"]:
+        """(Linux-only) Per-interface MB/s, packets, errors and drops per
+        second over `interval` ms (loopback excluded).
+        """
+        ...
+
+    def get_interface_stats_delta(
+        self,
+    ) -> Tuple[List["NetInterfaceStats"], float]:
+        """(Linux-only) Returns (interfaces, elapsed_ms) since the previous
+        call without sleeping. The first call returns zero rates.
+        """
+        ...
+
+    def get_backend(self) -> str:
+        """(Linux-only) The counter backend in use: 'netlink' or 'procfs'."""
+        ...
+
+
+class NetInterfaceStats:
+    """(Linux-only) Traffic rates of one network interface."""
+
+    name: str
+    rx_MBps: float
+    tx_MBps: float
+    rx_packets: float
+    tx_packets: float
+    rx_errors: float
+    tx_errors: float
+    rx_drops: float
+    tx_drops: float
+
+
+# ------------------------------------------------------------------
+# PyLivePressure
+# ------------------------------------------------------------------
+class PressureLine:
+    """(Linux-only) One line ("some" or "full") of a PSI pressure file."""
+
+    avg10: float
+    avg60: float
+    avg300: float
+    total_us: int
+
+
+class PressureStats:
+    """(Linux-only) Pressure of one resource."""
+
+    resource: str
+    some: PressureLine
+    full: PressureLine
+    has_full: bool
+
+
+class PyLivePressure:
+    """(Linux-only) Pressure stall information (PSI) of the system or of a
+    cgroup v2 group, with kernel-triggered notifications.
+    """
+
+    def __init__(self, cgroup: str = "") -> None:
+        """cgroup='' for the whole system (/proc/pressure), else a cgroup v2
+        directory, absolute or relative to /sys/fs/cgroup.
+        """
+        ...
+
+    def get_pressure(self, resource: str) -> PressureStats:
+        """Pressure of 'cpu', 'memory', 'io' or 'irq'."""
+        ...
+
+    def get_all(self) -> List[PressureStats]:
+        """Pressure of every available resource."""
+        ...
+
+    def add_trigger(
+        self,
+        resource: str,
+        stall_us: int,
+        window_us: int = 2000000,
+        kind: str = "some",
+    ) -> int:
+        """Registers a PSI trigger that fires when tasks stall for stall_us
+        within any window_us window; returns its id.
+        """
+        ...
+
+    def remove_trigger(self, id: int) -> bool: ...
+
+    def trigger_count(self) -> int: ...
+
+    def wait(self, timeout_ms: int = -1) -> List[int]:
+        """Sleeps until triggers fire and returns their ids; empty on timeout
+        or interrupt().
+        """
+        ...
+
+    def interrupt(self) -> None:
+        """Makes a running wait() return. Thread-safe."""
+        ...
+
+    def get_cgroup(self) -> str: ...
+
+
+# ------------------------------------------------------------------
+# PySamplerService
+# ------------------------------------------------------------------
+class LiveSample:
+    """One timestamped set of metrics collected by PySamplerService."""
+
+    timestamp_ns: int
+    wall_time_ns: int
+    interval_ms: float
+    cpu_usage: float
+    ram_usage: float
+    ram_used_bytes: float
+    ram_total_bytes: float
+    disk_read_MBps: float
+    disk_write_MBps: float
+    net_MBps: float
+
+
+class PySamplerService:
+    """Collects CPU, RAM, disk and network metrics on a background native
+    thread into a fixed-capacity lock-free ring buffer.
+    """
+
+    def __init__(self, interval_ms: int = 1000, capacity: int = 3600) -> None: ...
+
+    def start(self) -> None:
+        """Primes the collectors and starts the background thread."""
+        ...
+
+    def stop(self) -> None:
+        """Stops the background thread."""
+        ...
+
+    def is_running(self) -> bool: ...
+
+    def latest(self) -> Optional[LiveSample]:
+        """The most recent sample, or None if none was collected yet."""
+        ...
+
+    def history(self, count: int = 0) -> List[LiveSample]:
+        """Up to count recent samples, oldest first (0 = whole ring)."""
+        ...
+
+    def history_array(self, count: int = 0) -> "numpy.ndarray":
+        """Same as history(), as a NumPy structured array with one field per
+        LiveSample attribute. The array owns a native copy of the ring.
+        """
+        ...
+
+    def history_columns(self, count: int = 0) -> Dict[str, "numpy.ndarray"]:
+        """Same as history(), as one 1-D NumPy array per attribute; all are
+        views of the same buffer. On Linux also core_usage,
+        disk_read/write_MBps_per_device and net_rx/tx_MBps_per_interface:
+        2-D arrays with one row per sample and one column per entry of
+        history_layout().
+        """
+        ...
+
+    def set_interval(self, ms: int) -> None: ...
+
+    def get_interval(self) -> int: ...
+
+    def sample_count(self) -> int:
+        """Total number of samples collected since creation."""
+        ...
+
+    def capacity(self) -> int:
+        """Number of samples kept in the history ring."""
+        ...
+
+    def get_error_count(self) -> int:
+        """Number of collection passes that failed."""
+        ...
+
+    def start_recording(self, path: str, sensors: bool = False) -> None:
+        """(Linux only) Appends the raw counters of every pass to a
+        recording file (created if needed); sensors=True also records every
+        sensor value. Replay it with PyLiveReplay.
+        """
+        ...
+
+    def stop_recording(self) -> None:
+        """(Linux only) Stops recording and closes the file."""
+        ...
+
+    def is_recording(self) -> bool:
+        """(Linux only) True while recording."""
+        ...
+
+    def start_publishing(self, name: str = "/hardview") -> None:
+        """(Linux only) Publishes every sample into the shared-memory segment
+        /dev/shm/<name> for PySharedMetricsReader.
+        """
+        ...
+
+    def stop_publishing(self) -> None:
+        """(Linux only) Stops publishing and removes the segment."""
+        ...
+
+    def is_publishing(self) -> bool:
+        """(Linux only) True while publishing."""
+        ...
+
+    def history_layout(self) -> Dict[str, list]:
+        """(Linux only) Columns of the 2-D history_columns() arrays: "cores"
+        (core numbers), "disks" and "interfaces" (names). Fixed by the first
+        start().
+        """
+        ...
+
+
+class PyLiveReplay:
+    """(Linux only) Replays a PySamplerService recording through the same
+    rate computations as the live collectors.
+    """
+
+    def __init__(self, path: str) -> None: ...
+
+    def next(self) -> Optional[LiveSample]:
+        """The next sample, or None at the end of the recording."""
+        ...
+
+    def read(self, count: int = 0) -> List[LiveSample]:
+        """Up to count samples, replayed as fast as possible (0 = all)."""
+        ...
+
+    def play(self, callback: Callable[[LiveSample], None], speed: float = 1.0) -> int:
+        """Calls callback(sample) for every remaining sample at the recorded
+        cadence divided by speed (<= 0: as fast as possible). Returns the
+        number of samples.
+        """
+        ...
+
+    def get_sensors(self) -> List[Tuple[str, float, str, str]]:
+        """(label, value, chip, type) of every sensor in the current frame;
+        empty if sensors were not recorded.
+        """
+        ...
+
+    def rewind(self) -> None:
+        """Starts over from the first frame."""
+        ...
+
+    def frame_count(self) -> int:
+        """Number of frames read so far, priming frames included."""
+        ...
+
+
+# ------------------------------------------------------------------
+# PyMetricsExporter
+# ------------------------------------------------------------------
+class PyMetricsExporter:
+    """(Linux only) Serves the latest PySamplerService values as Prometheus /
+    OpenMetrics text on http://address:port/metrics.
+    """
+
+    def __init__(self, sampler: PySamplerService, address: str = "127.0.0.1",
+                 port: int = 9101, labels: Dict[str, str] = {}) -> None: ...
+
+    def start(self) -> None:
+        """Binds the address and starts serving /metrics."""
+        ...
+
+    def stop(self) -> None:
+        """Stops serving."""
+        ...
+
+    def is_running(self) -> bool: ...
+
+    def get_port(self) -> int:
+        """The port being served (0 while stopped)."""
+        ...
+
+    def get_address(self) -> str: ...
+
+    def scrape_count(self) -> int:
+        """Number of /metrics requests answered."""
+        ...
+
+
+# ------------------------------------------------------------------
+# PySharedMetricsReader
+# ------------------------------------------------------------------
+class PySharedMetricsReader:
+    """(Linux only) Reads the samples another process publishes with
+    PySamplerService.start_publishing(), without any system call.
+    """
+
+    def __init__(self, name: str = "/hardview") -> None: ...
+
+    def read(self) -> Optional[LiveSample]:
+        """The latest published sample, or None if none was published yet."""
+        ...
+
+    def sample_count(self) -> int:
+        """Samples collected by the publisher."""
+        ...
+
+    def get_error_count(self) -> int:
+        """Failed collection passes of the publisher."""
+        ...
+
+    def publisher_pid(self) -> int:
+        """Pid of the publisher, 0 once it stopped."""
+        ...
+
+    def publisher_alive(self) -> bool:
+        """Whether the publishing process is still running."""
+        ...
+
+    def get_name(self) -> str: ...
+
+
+# ------------------------------------------------------------------
+# PyLiveSnapshot
+# ------------------------------------------------------------------
+SNAPSHOT_CPU: int
+SNAPSHOT_RAM: int
+SNAPSHOT_DISK: int
+SNAPSHOT_NETWORK: int
+SNAPSHOT_ALL: int
+
+
+class SnapshotResult:
+    """Rates of several subsystems measured over one shared interval.
+    Fields of subsystems that were not requested are -1.
+    """
+
+    interval_ms: float
+    cpu_usage: float
+    ram_usage: float
+    ram_used_bytes: float
+    ram_total_bytes: float
+    disk_read_MBps: float
+    disk_write_MBps: float
+    net_MBps: float
+    net_interfaces: List[Tuple[str, float]]
+
+
+class PyLiveSnapshot:
+    """Measures CPU, RAM, disk and network together: all "before" readings,
+    one wait, then all "after" readings.
+    """
+
+    def __init__(self, subsystems: int = ...) -> None:
+        """subsystems is a bitmask of the SNAPSHOT_* constants
+        (default SNAPSHOT_ALL).
+        """
+        ...
+
+    def take(self, interval_ms: int = 1000) -> SnapshotResult:
+        """Measures all selected subsystems over one shared interval."""
+        ...
+
+
+# ------------------------------------------------------------------
+# Collector cost accounting
+# ------------------------------------------------------------------
+class CollectorStats:
+    """Cost of one collector (cpu, ram, disk, network, sensors, cpuid,
+    cpufreq, pressure) since the last reset. Times are in nanoseconds.
+    """
+
+    name: str
+    calls: int
+    errors: int
+    syscalls: int
+    bytes_read: int
+    total_ns: int
+    io_ns: int
+    parse_ns: int
+    max_ns: int
+    p50_ns: int
+    p90_ns: int
+    p99_ns: int
+    histogram: List[Tuple[int, int]]
+
+
+def get_collector_stats() -> List[CollectorStats]:
+    """Returns the calls, errors, syscalls, bytes read, I/O and parse time and
+    latency histogram of every collector since the last reset.
+    """
+    ...
+
+
+def reset_collector_stats() -> None:
+    """Zeroes the counters of every collector."""
+    ...
+
 
 # ------------------------------------------------------------------
 # PyLiveGpu (Windows-only)
@@ -316,10 +851,25 @@ class PyManageTemp:
 # ------------------------------------------------------------------
 # PyLinuxSensor (Linux-only)
 # ------------------------------------------------------------------
+SENSOR_BACKEND_AUTO: int
+SENSOR_BACKEND_LIBSENSORS: int
+SENSOR_BACKEND_HWMON: int
+
+
 class PyLinuxSensor:
-    """(Linux-only) Reads sensor temperatures via libsensors."""
+    """(Linux-only) Reads sensor temperatures via libsensors, or directly
+    from /sys/class/hwmon."""
 
-    def __init__(self) -> None: ...
+    def __init__(self, backend: int = 0) -> None:
+        """backend: SENSOR_BACKEND_AUTO (libsensors, or the hwmon reader if
+        libsensors is unavailable), SENSOR_BACKEND_LIBSENSORS or
+        SENSOR_BACKEND_HWMON.
+        """
+        ...
+
+    def get_backend(self) -> str:
+        """The sensor backend in use: 'libsensors' or 'hwmon'."""
+        ...
 
     def get_cpu_temp(self) -> float:
         """Cached CPU package temperature."""
@@ -359,11 +909,39 @@ class PyLinuxSensor:
         ...
 
     def get_sensors_with_temp(self) -> List[Tuple[str, float]]:
-        """Live (sensor_name, temperature) pairs for every cached sensor name."""
+        """Live (sensor_name, value) pairs for every sensor, read in one pass."""
+        ...
+
+    def get_all_sensors(self) -> List[Tuple[str, float, str, str]]:
+        """Live (label, value, chip, type) tuples for every sensor, read in
+        one pass. type is 'temp', 'fan', 'in', 'power', ...
+        """
+        ...
+
+    def get_all_sensors_array(self) -> "numpy.ndarray":
+        """Same as get_all_sensors() as a NumPy structured array with dtype
+        [('label', 'S64'), ('value', '<f8'), ('chip', 'S32'), ('type', 'S16')].
+        """
         ...
 
     def update(self, names: bool = False) -> None:
         """Refreshes cached temperature readings. If names is True, also
-        re-scans the list of available sensor names.
+        rescans the sensor chips and the list of available sensor names.
         """
         ...
+
+
+# ------------------------------------------------------------------
+# Sysroot (Linux only)
+# ------------------------------------------------------------------
+def set_sys_root(root: str) -> None:
+    """Reads every /proc and /sys file under root instead of / (e.g. a tree
+    captured with Tools/SysCapture). '' reads the live system again.
+    Raises ValueError if root is not a directory.
+    """
+    ...
+
+
+def get_sys_root() -> str:
+    """Returns the current sysroot, '' for the live system."""
+    ...
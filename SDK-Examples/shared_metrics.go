@@ -0,0 +1,101 @@
+// shared_metrics.go
+// Example of reading the metrics a HardView process publishes with
+// PySamplerService.start_publishing() (Linux), without loading HardView.
+// The segment layout is described in HardView/LiveView/include/SharedMetrics.hpp.
+//
+//   python -c "from HardView.LiveView import PySamplerService; import time; \
+//              s = PySamplerService(); s.start_publishing(); s.start(); time.sleep(60)" &
+//   go run shared_metrics.go
+
+package main
+
+import (
+	"bytes"
+	"fmt"
+	"os"
+	"runtime"
+	"sync/atomic"
+	"syscall"
+	"time"
+	"unsafe"
+)
+
+const (
+	segmentPath = "/dev/shm/hardview"
+	segmentSize = 128
+	version     = 1
+)
+
+// Sample mirrors LiveView::SharedSample (offset 32 of the segment)
+type Sample struct {
+	TimestampNs   int64
+	WallTimeNs    int64
+	IntervalMs    float64
+	CpuUsage      float64
+	RamUsage      float64
+	RamUsedBytes  float64
+	RamTotalBytes float64
+	DiskReadMBps  float64
+	DiskWriteMBps float64
+	NetMBps       float64
+	SampleCount   uint64
+	ErrorCount    uint64
+}
+
+// Open maps the segment read-only and checks its header
+func Open(path string) ([]byte, error) {
+	f, err := os.Open(path)
+	if err != nil {
+		return nil, err
+	}
+	defer f.Close()
+	data, err := syscall.Mmap(int(f.Fd()), 0, segmentSize, syscall.PROT_READ, syscall.MAP_SHARED)
+	if err != nil {
+		return nil, err
+	}
+	if !bytes.Equal(data[0:8], []byte("HVSHMET\x00")) || *(*uint32)(unsafe.Pointer(&data[8])) != version {
+		syscall.Munmap(data)
+		return nil, fmt.Errorf("%s is not a version %d HardView metrics segment", path, version)
+	}
+	return data, nil
+}
+
+// Read copies a consistent sample: the seqlock at offset 24 is odd while
+// the publisher writes, and changes if a write happened during the copy.
+func Read(data []byte) (Sample, bool) {
+	seq := (*uint64)(unsafe.Pointer(&data[24]))
+	for {
+		before := atomic.LoadUint64(seq)
+		if before&1 != 0 {
+			runtime.Gosched()
+			continue
+		}
+		sample := *(*Sample)(unsafe.Pointer(&data[32]))
+		if atomic.LoadUint64(seq) == before {
+			return sample, sample.SampleCount != 0
+		}
+	}
+}
+
+func main() {
+	data, err := Open(segmentPath)
+	if err != nil {
+		fmt.Println("Error:", err)
+		os.Exit(1)
+	}
+	defer syscall.Munmap(data)
+
+	for i := 0; i < 5; i++ {
+		if atomic.LoadInt32((*int32)(unsafe.Pointer(&data[16]))) == 0 {
+			fmt.Println("The publisher stopped")
+			break
+		}
+		if s, ok := Read(data); ok {
+			fmt.Printf("#%d CPU %.1f%%  RAM %.1f%%  Disk R/W %.2f/%.2f MB/s  Net %.3f MB/s\n",
+				s.SampleCount, s.CpuUsage, s.RamUsage, s.DiskReadMBps, s.DiskWriteMBps, s.NetMBps)
+		} else {
+			fmt.Println("No sample published yet")
+		}
+		time.Sleep(time.Second)
+	}
+}
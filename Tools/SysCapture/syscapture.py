@@ -0,0 +1,200 @@
+"""
+==============================================================================
+ GNU GENERAL PUBLIC LICENSE (GPL-3)
+
+ Copyright (c) 2025 gafoo
+
+ This file is part of the HardView project:
+ https://github.com/gafoo173/HardView
+
+ License Notice:
+ This file is licensed under the  (GPL-3),
+ located in the "LICENSE.GPL3" file at the project root.
+
+ Note:
+ While the main HardView project is licensed under the MIT License,
+ all tool-related files under the "Tools" directory are licensed under GPL-3.
+==============================================================================
+"""
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+
+# ================================================
+# SysCapture - snapshot of the Linux files HardView reads
+#
+# Copies the /proc and /sys files read by LiveView, LinuxInfo and the
+# legacy Linux helpers into a directory laid out like /, so that a machine
+# can be replayed elsewhere:
+#
+#   python syscapture.py -o capture/           # Capture this machine
+#   python syscapture.py -o capture/ --tar     # ... and pack capture.tar.gz
+#   HARDVIEW_SYSROOT=capture/ python app.py    # Read it back
+#
+# or HardView.LiveView.set_sys_root("capture/") from Python. The tree has
+# the layout of tests/bench/fixtures, so it can also be passed to the
+# benchmark with --fixtures.
+#
+# sysfs class directories are made of symlinks into /sys/devices, which in
+# turn link back to their subsystem, driver and parent devices. Only the
+# links HardView follows (the class entries and "device") are dereferenced,
+# every other link is skipped, and each tree has a depth limit, so the
+# capture stays small and cannot loop.
+# ================================================
+
+import argparse
+import os
+import sys
+import tarfile
+
+# Single files, captured as they are.
+PROC_FILES = [
+    "proc/stat",
+    "proc/meminfo",
+    "proc/diskstats",
+    "proc/net/dev",
+    "proc/cpuinfo",
+    "proc/loadavg",
+    "proc/uptime",
+    "proc/partitions",
+    "proc/swaps",
+    "proc/version",
+]
+
+# (directory, depth): files up to `depth` directories below it are captured.
+TREES = [
+    ("proc/pressure", 0),
+    ("sys/class/hwmon", 2),
+    ("sys/class/thermal", 1),
+    ("sys/class/net", 2),
+    ("sys/class/drm", 2),
+    ("sys/class/kfd", 3),
+    ("sys/class/power_supply", 1),
+    ("sys/class/dmi/id", 0),
+    ("sys/block", 1),
+    ("sys/bus/usb/devices", 1),
+    ("sys/bus/pci/devices", 1),
+    ("sys/devices/system/cpu", 2),
+    ("sys/firmware/dmi/tables", 0),
+]
+
+# Symlinks followed below the top level of a tree.
+FOLLOWED_LINKS = {"device"}
+
+# sysfs attributes are small; larger files (firmware blobs, PCI config and
+# ROM images...) are cut to this size.
+MAX_FILE_SIZE = 1 << 20
+
+
+def read_file(path):
+    """Reads a procfs/sysfs file. Returns None if it cannot be read."""
+    try:
+        # O_NONBLOCK: a few sysfs attributes wait for the hardware.
+        fd = os.open(path, os.O_RDONLY | os.O_NONBLOCK)
+    except OSError:
+        return None
+    try:
+        chunks = []
+        size = 0
+        while size < MAX_FILE_SIZE:
+            chunk = os.read(fd, 65536)
+            if not chunk:
+                break
+            chunks.append(chunk)
+            size += len(chunk)
+        return b"".join(chunks)[:MAX_FILE_SIZE]
+    except OSError:
+        return None
+    finally:
+        os.close(fd)
+
+
+class Capture:
+    def __init__(self, source, output, verbose=False):
+        self.source = source
+        self.output = output
+        self.verbose = verbose
+        self.files = 0
+        self.bytes = 0
+        self.skipped = 0
+
+    def copy_file(self, relative):
+        data = read_file(os.path.join(self.source, relative))
+        if data is None:
+            self.skipped += 1
+            if self.verbose:
+                print("skipped: /" + relative, file=sys.stderr)
+            return
+        target = os.path.join(self.output, relative)
+        os.makedirs(os.path.dirname(target), exist_ok=True)
+        with open(target, "wb") as f:
+            f.write(data)
+        self.files += 1
+        self.bytes += len(data)
+
+    def copy_tree(self, relative, depth, top=True):
+        """Captures a directory, dereferencing the links HardView follows."""
+        path = os.path.join(self.source, relative)
+        try:
+            names = sorted(os.listdir(path))
+        except OSError:
+            return
+        os.makedirs(os.path.join(self.output, relative), exist_ok=True)
+        for name in names:
+            child = os.path.join(relative, name)
+            full = os.path.join(self.source, child)
+            if os.path.islink(full) and not top and name not in FOLLOWED_LINKS:
+                continue
+            if os.path.isdir(full):
+                if depth > 0:
+                    self.copy_tree(child, depth - 1, top=False)
+                else:
+                    # Kept empty: some readers only test that it exists.
+                    os.makedirs(os.path.join(self.output, child), exist_ok=True)
+            elif os.path.isfile(full):
+                self.copy_file(child)
+
+    def run(self):
+        for relative in PROC_FILES:
+            if os.path.isfile(os.path.join(self.source, relative)):
+                self.copy_file(relative)
+        for relative, depth in TREES:
+            self.copy_tree(relative, depth)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Capture the /proc and /sys files read by HardView into "
+                    "a directory usable as HARDVIEW_SYSROOT.")
+    parser.add_argument("-o", "--output", required=True,
+                        help="Directory to create the capture in")
+    parser.add_argument("--source", default="/",
+                        help="Root to capture from (default: /)")
+    parser.add_argument("--tar", action="store_true",
+                        help="Also pack the capture into OUTPUT.tar.gz")
+    parser.add_argument("-v", "--verbose", action="store_true",
+                        help="List the files that could not be read")
+    args = parser.parse_args()
+
+    if not sys.platform.startswith("linux") and args.source == "/":
+        print("syscapture: the live system can only be captured on Linux.",
+              file=sys.stderr)
+        return 1
+
+    capture = Capture(args.source, args.output, args.verbose)
+    capture.run()
+    print("Captured %d files (%d bytes) into %s, %d unreadable."
+          % (capture.files, capture.bytes, args.output, capture.skipped))
+    if capture.skipped and os.geteuid() != 0:
+        print("Some files (e.g. sys/firmware/dmi/tables) are only readable "
+              "by root.")
+
+    if args.tar:
+        archive = args.output.rstrip("/") + ".tar.gz"
+        with tarfile.open(archive, "w:gz") as tar:
+            tar.add(args.output, arcname=os.path.basename(args.output.rstrip("/")))
+        print("Packed " + archive)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
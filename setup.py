@@ -31,12 +31,18 @@ hardview_source_files = [
 
 hardview_libraries = []
 hardview_extra_compile_args = []
+hardview_extra_link_args = []
 
 if sys.platform.startswith('win'):
     hardview_source_files.append(f'{LEGACY_DIR}/win_helpers.c')
     hardview_libraries.extend(['wbemuuid', 'ole32', 'oleaut32'])
 elif sys.platform.startswith('linux') or sys.platform.startswith('darwin'):
     hardview_source_files.append(f'{LEGACY_DIR}/linux_helpers.c')
+if sys.platform.startswith('linux'):
+    # C++ bridge to the LiveView hotplug listener; it makes the extension
+    # link with the C++ runtime, statically as for LiveView below
+    hardview_source_files.append(f'{LEGACY_DIR}/hotplug_shim.cpp')
+    hardview_extra_link_args.append('-static-libstdc++')
 
 # Define the main C extension as a submodule of HardView
 hardview_module = Extension(
@@ -44,6 +50,7 @@ hardview_module = Extension(
     sources=hardview_source_files,
     define_macros=[('BUILD_PYTHON_MODULE', '1')],
     extra_compile_args=hardview_extra_compile_args,
+    extra_link_args=hardview_extra_link_args,
     libraries=hardview_libraries,
     library_dirs=[],
     include_dirs=[LEGACY_DIR]
@@ -68,7 +75,9 @@ elif sys.platform.startswith('linux') or sys.platform.startswith('darwin'):
     liveview_extra_compile_args.append('-std=c++17')
     # Add flag for static linking with GCC C++ runtime
     liveview_extra_link_args.append('-static-libstdc++')
-    liveview_libraries.append('sensors')
+    # libsensors is loaded at runtime with dlopen() when it is installed;
+    # PyLinuxSensor falls back to reading /sys/class/hwmon directly.
+    liveview_libraries.append('dl')
 
 # Define the new C++ extension as a submodule of HardView
 liveview_module = Extension(
@@ -0,0 +1,114 @@
+/*
+================================================================================
+ MIT License
+
+ Copyright (c) 2025 gafoo
+
+ This file is part of the HardView project:
+ https://github.com/gafoo173/HardView
+
+ Licensed under the MIT License.
+ See the LICENSE file in the project root for more details.
+================================================================================
+*/
+// ===================================================================================
+// alloc_counter.hpp: Counts heap allocations for the benchmarks.
+//
+// Replaces every form of the global operator new (plain, array, aligned and
+// nothrow) with malloc/aligned_alloc (_aligned_malloc on Windows) plus a
+// counter in g_allocs, and the matching operator delete forms. Include it
+// from exactly one translation unit: the replacements are definitions.
+// ===================================================================================
+#ifndef HV_BENCH_ALLOC_COUNTER_HPP
+#define HV_BENCH_ALLOC_COUNTER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+static std::atomic<long long> g_allocs{0};
+
+static void *counted_alloc(std::size_t size, std::size_t align) noexcept {
+  g_allocs.fetch_add(1, std::memory_order_relaxed);
+  if (size == 0)
+    size = 1;
+#ifdef _WIN32
+  return _aligned_malloc(size, align > alignof(std::max_align_t)
+                                   ? align
+                                   : alignof(std::max_align_t));
+#else
+  if (align <= alignof(std::max_align_t))
+    return std::malloc(size);
+  // aligned_alloc wants a multiple of the alignment
+  return std::aligned_alloc(align, (size + align - 1) / align * align);
+#endif
+}
+
+static void counted_free(void *p) noexcept {
+#ifdef _WIN32
+  _aligned_free(p);
+#else
+  std::free(p);
+#endif
+}
+
+static void *counted_alloc_or_throw(std::size_t size, std::size_t align) {
+  if (void *p = counted_alloc(size, align))
+    return p;
+  throw std::bad_alloc();
+}
+
+// GCC sees the malloc of a new-expression through the inlined operator new
+// and warns about the free in operator delete; that pairing is intended.
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void *operator new(std::size_t size) {
+  return counted_alloc_or_throw(size, 0);
+}
+void *operator new[](std::size_t size) {
+  return counted_alloc_or_throw(size, 0);
+}
+void *operator new(std::size_t size, std::align_val_t align) {
+  return counted_alloc_or_throw(size, static_cast<std::size_t>(align));
+}
+void *operator new[](std::size_t size, std::align_val_t align) {
+  return counted_alloc_or_throw(size, static_cast<std::size_t>(align));
+}
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept {
+  return counted_alloc(size, 0);
+}
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept {
+  return counted_alloc(size, 0);
+}
+
+void operator delete(void *p) noexcept { counted_free(p); }
+void operator delete[](void *p) noexcept { counted_free(p); }
+void operator delete(void *p, std::size_t) noexcept { counted_free(p); }
+void operator delete[](void *p, std::size_t) noexcept { counted_free(p); }
+void operator delete(void *p, std::align_val_t) noexcept { counted_free(p); }
+void operator delete[](void *p, std::align_val_t) noexcept { counted_free(p); }
+void operator delete(void *p, std::size_t, std::align_val_t) noexcept {
+  counted_free(p);
+}
+void operator delete[](void *p, std::size_t, std::align_val_t) noexcept {
+  counted_free(p);
+}
+void operator delete(void *p, const std::nothrow_t &) noexcept {
+  counted_free(p);
+}
+void operator delete[](void *p, const std::nothrow_t &) noexcept {
+  counted_free(p);
+}
+
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic pop
+#endif
+
+#endif // HV_BENCH_ALLOC_COUNTER_HPP
@@ -0,0 +1,161 @@
+#!/usr/bin/env python3
+"""
+Generates the binary benchmark fixtures:
+  sys/firmware/dmi/tables/smbios_entry_point, sys/firmware/dmi/tables/DMI
+      SMBIOS 3.2 table of a desktop (BIOS, system, board, chassis, CPU with
+      three caches, ports, slots, 2 x 16 GB DIMMs + 2 empty slots).
+  smart/ata_smart_data.bin
+      512-byte ATA SMART READ DATA page of a SATA SSD.
+
+Field offsets follow the SMBIOS 3.2 and ATA/ATAPI-8 specifications, so the
+files parse like a real dump. Run from this directory.
+"""
+
+import os
+import struct
+
+
+def structure(type_, handle, formatted, strings):
+    """One SMBIOS structure: header, formatted area and string set."""
+    body = bytes([type_, 4 + len(formatted)]) + struct.pack("<H", handle) + formatted
+    if strings:
+        body += b"".join(s.encode() + b"\0" for s in strings) + b"\0"
+    else:
+        body += b"\0\0"
+    return body
+
+
+def smbios_table():
+    t = []
+    # Type 0: BIOS Information
+    t.append(structure(0, 0x0000, bytes([1, 2]) + struct.pack("<H", 0xF000) +
+                       bytes([3, 0xFF]) + struct.pack("<Q", 0x0B8B9A80) +
+                       bytes([0x03, 0x0D, 5, 17, 0xFF, 0xFF]) + struct.pack("<H", 32),
+                       ["American Megatrends Inc.", "F12", "08/25/2023"]))
+    # Type 1: System Information
+    uuid = bytes(range(0x10, 0x20))
+    t.append(structure(1, 0x0001, bytes([1, 2, 3, 4]) + uuid + bytes([6, 5, 6]),
+                       ["Gigabyte Technology Co., Ltd.", "Z270X-Gaming 5",
+                        "Default string", "Default string", "Default string",
+                        "Default string"]))
+    # Type 2: Baseboard Information
+    t.append(structure(2, 0x0002, bytes([1, 2, 3, 4, 5, 0x09, 6]) +
+                       struct.pack("<H", 0x0003) + bytes([0x0A, 0]),
+                       ["Gigabyte Technology Co., Ltd.", "Z270X-Gaming 5-CF",
+                        "x.x", "Default string", "Default string",
+                        "Default string"]))
+    # Type 3: System Enclosure
+    t.append(structure(3, 0x0003, bytes([1, 0x03, 2, 3, 4, 3, 3, 3, 3]) +
+                       struct.pack("<I", 0) + bytes([0, 0, 0, 0, 5]),
+                       ["Default string", "Default string", "Default string",
+                        "Default string", "Default string"]))
+    # Type 7: Cache Information (L1, L2, L3)
+    caches = [(0x0004, "L1 Cache", 0x180, 256, 0x07), (0x0005, "L2 Cache", 0x181, 1024, 0x05),
+              (0x0006, "L3 Cache", 0x182, 8192, 0x08)]
+    for handle, name, config, kb, assoc in caches:
+        t.append(structure(7, handle, bytes([1]) + struct.pack("<HHHHH", config, kb, kb, 0x20, 0x20) +
+                           bytes([0, 0x06, 0x05, assoc]) + struct.pack("<II", kb, kb),
+                           [name]))
+    # Type 4: Processor Information
+    t.append(structure(4, 0x0007, bytes([1, 0x03, 0xC6, 2]) +
+                       struct.pack("<Q", 0xBFEBFBFF000906E9) + bytes([3, 0x8B]) +
+                       struct.pack("<HHH", 100, 8300, 3600) + bytes([0x41, 0x2A]) +
+                       struct.pack("<HHH", 0x0004, 0x0005, 0x0006) + bytes([4, 5, 6, 4, 4, 8]) +
+                       struct.pack("<HHHHH", 0x00FC, 0xC6, 4, 4, 8),
+                       ["U3E1", "Intel(R) Corporation",
+                        "Intel(R) Core(TM) i7-7700 CPU @ 3.60GHz", "To Be Filled By O.E.M.",
+                        "To Be Filled By O.E.M.", "To Be Filled By O.E.M."]))
+    # Type 8: Port Connector Information
+    ports = [("PS2Mouse", 0x0F, 0x0E), ("USB1", 0x12, 0x10), ("LAN", 0x0B, 0x1F), ("AUDIO1", 0x1F, 0x1D)]
+    for i, (name, connector, port) in enumerate(ports):
+        t.append(structure(8, 0x0008 + i, bytes([1, 0, 2, connector, port]), [name, name]))
+    # Type 9: System Slots
+    slots = [("PCIEX16", 0xB6, 0x0D, 0x01), ("PCIEX1_1", 0xB6, 0x08, 0x02), ("PCIEX4", 0xB6, 0x0A, 0x03)]
+    for i, (name, type_, width, bus) in enumerate(slots):
+        t.append(structure(9, 0x0010 + i, bytes([1, type_, width, 0x04 if i == 0 else 0x03, 0x04]) +
+                           struct.pack("<H", i) + bytes([0x0C, 0x03]) + struct.pack("<H", 0) +
+                           bytes([bus, 0x00]), [name]))
+    # Type 16: Physical Memory Array
+    t.append(structure(16, 0x0020, bytes([0x03, 0x03, 0x03]) + struct.pack("<I", 64 * 1024 * 1024) +
+                       struct.pack("<HH", 0xFFFE, 4) + struct.pack("<Q", 0), []))
+    # Type 17: Memory Device (2 populated, 2 empty)
+    for i in range(4):
+        populated = i % 2 == 1
+        size = 16384 if populated else 0
+        speed = 2400 if populated else 0
+        strings = ["ChannelA-DIMM%d" % (i % 2) if i < 2 else "ChannelB-DIMM%d" % (i % 2),
+                   "BANK %d" % i]
+        if populated:
+            strings += ["Kingston", "2A1B3C4D", "9876543210", "KHX2400C15/16G"]
+            refs = bytes([3, 4, 5, 6])
+        else:
+            refs = bytes([0, 0, 0, 0])
+        t.append(structure(17, 0x0021 + i, struct.pack("<HHHHH", 0x0020, 0xFFFE,
+                                                       64 if populated else 0xFFFF,
+                                                       64 if populated else 0xFFFF, size) +
+                           bytes([0x09, 0, 1, 2, 0x1A if populated else 0x02]) +
+                           struct.pack("<H", 0x0080 if populated else 0x0004) +
+                           struct.pack("<H", speed) + refs + bytes([2 if populated else 0]) +
+                           struct.pack("<IHHHH", 0, speed, 1200 if populated else 0,
+                                       1200 if populated else 0, 1200 if populated else 0),
+                           strings))
+    # Type 32: System Boot Information
+    t.append(structure(32, 0x0030, bytes(6) + bytes([0]), []))
+    # Type 127: End-of-Table
+    t.append(structure(127, 0x0031, b"", []))
+    return b"".join(t)
+
+
+def smbios_entry_point(table_size):
+    """64-bit "_SM3_" entry point of a 3.2 table."""
+    entry = bytearray(b"_SM3_" + bytes([0, 0x18, 3, 2, 0, 1, 0]) +
+                      struct.pack("<IQ", table_size, 0x000E9000))
+    entry[5] = (-sum(entry)) & 0xFF
+    return bytes(entry)
+
+
+def smart_data():
+    """ATA SMART READ DATA page: 30 attribute slots + offline data."""
+    attributes = [  # (id, flags, current, worst, raw)
+        (0x01, 0x002F, 100, 100, 0),
+        (0x05, 0x0032, 100, 100, 0),
+        (0x09, 0x0032, 99, 99, 18273),
+        (0x0C, 0x0032, 99, 99, 1287),
+        (0xA1, 0x0033, 100, 100, 8),
+        (0xA4, 0x0032, 100, 100, 0),
+        (0xA5, 0x0032, 100, 100, 0),
+        (0xA6, 0x0032, 100, 100, 0),
+        (0xAB, 0x0032, 100, 100, 0),
+        (0xAC, 0x0032, 100, 100, 0),
+        (0xAE, 0x0032, 100, 100, 73),
+        (0xB1, 0x0013, 94, 94, 128),
+        (0xBB, 0x0032, 100, 100, 0),
+        (0xC2, 0x0022, 66, 45, 0x0037002D0022),
+        (0xC4, 0x0032, 100, 100, 0),
+        (0xC7, 0x0032, 100, 100, 0),
+        (0xCA, 0x0030, 94, 94, 6),
+        (0xE7, 0x0033, 94, 94, 94),
+        (0xF1, 0x0030, 100, 100, 928374),
+        (0xF2, 0x0030, 100, 100, 1827364),
+    ]
+    page = bytearray(struct.pack("<H", 0x0010))
+    for id_, flags, current, worst, raw in attributes:
+        page += struct.pack("<BHBB", id_, flags, current, worst) + raw.to_bytes(6, "little") + b"\0"
+    page += bytes(12 * (30 - len(attributes)))
+    page += bytes([0x00, 0x00]) + struct.pack("<H", 0) + bytes([0, 0x5B]) + struct.pack("<H", 3)
+    page += bytes([1, 0, 2, 10]) + bytes(12) + bytes(125)
+    page.append((-sum(page)) & 0xFF)
+    assert len(page) == 512
+    return bytes(page)
+
+
+if __name__ == "__main__":
+    os.makedirs("sys/firmware/dmi/tables", exist_ok=True)
+    table = smbios_table()
+    with open("sys/firmware/dmi/tables/DMI", "wb") as f:
+        f.write(table)
+    with open("sys/firmware/dmi/tables/smbios_entry_point", "wb") as f:
+        f.write(smbios_entry_point(len(table)))
+    os.makedirs("smart", exist_ok=True)
+    with open("smart/ata_smart_data.bin", "wb") as f:
+        f.write(smart_data())
@@ -0,0 +1,184 @@
+/*
+================================================================================
+ MIT License
+
+ Copyright (c) 2025 gafoo
+
+ This file is part of the HardView project:
+ https://github.com/gafoo173/HardView
+
+ Licensed under the MIT License.
+ See the LICENSE file in the project root for more details.
+================================================================================
+*/
+// ===================================================================================
+// proc_parsers_bench.cpp: Micro-benchmark of the /proc/diskstats and
+// /proc/net/dev parsers used by LiveView (Linux only).
+//
+// Compares the previous ifstream/stringstream/std::map parsers ("before")
+// with the DeviceTable parsers from ProcStats.hpp ("after"), and the netlink
+// RTM_GETSTATS backend from NetlinkStats.hpp. One sample is a full read +
+// parse + rate computation, as done by get_usage_delta().
+//
+// Build and run:
+//   g++ -std=c++17 -O2 tests/bench/proc_parsers_bench.cpp -o proc_parsers_bench
+//   ./proc_parsers_bench [iterations]
+// ===================================================================================
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <new>
+#include <sstream>
+#include <string>
+
+#include "../../HardView/LiveView/include/NetlinkStats.hpp"
+#include "../../HardView/LiveView/include/ProcStats.hpp"
+#include "alloc_counter.hpp"
+
+// --- Previous implementation ---
+namespace before {
+
+struct DiskStats {
+  long long sectors_read;
+  long long sectors_written;
+};
+
+struct NetworkStats {
+  long long bytes_received;
+  long long bytes_transmitted;
+};
+
+std::map<std::string, DiskStats> get_disk_stats() {
+  std::ifstream file("/proc/diskstats");
+  if (!file.is_open())
+    throw std::runtime_error("Failed to open /proc/diskstats.");
+  std::map<std::string, DiskStats> stats;
+  std::string line;
+  while (std::getline(file, line)) {
+    std::stringstream ss(line);
+    int major, minor;
+    std::string device_name;
+    long long reads, reads_merged, sectors_read, time_reading, writes,
+        writes_merged, sectors_written;
+    ss >> major >> minor >> device_name >> reads >> reads_merged >>
+        sectors_read >> time_reading >> writes >> writes_merged >>
+        sectors_written;
+    if (isdigit(device_name.back()))
+      continue; // Skip partitions
+    stats[device_name] = {sectors_read, sectors_written};
+  }
+  return stats;
+}
+
+std::map<std::string, NetworkStats> get_network_stats() {
+  std::ifstream file("/proc/net/dev");
+  if (!file.is_open())
+    throw std::runtime_error("Failed to open /proc/net/dev.");
+  std::map<std::string, NetworkStats> stats;
+  std::string line;
+  std::getline(file, line); // Skip header line 1
+  std::getline(file, line); // Skip header line 2
+  while (std::getline(file, line)) {
+    std::stringstream ss(line);
+    std::string iface_name;
+    long long recv_bytes, trans_bytes;
+    ss >> iface_name >> recv_bytes;
+    for (int i = 0; i < 7; ++i)
+      ss.ignore(256, ' ');
+    ss >> trans_bytes;
+    if (iface_name.back() == ':')
+      iface_name.pop_back();
+    if (iface_name == "lo")
+      continue; // Skip loopback
+    stats[iface_name] = {recv_bytes, trans_bytes};
+  }
+  return stats;
+}
+
+} // namespace before
+
+// --- Benchmark driver ---
+static volatile long long g_sink;
+
+template <typename F> static void run(const char *name, int iterations, F f) {
+  f(); // Warm-up: lets buffers and tables reach their working size
+  long long allocs = g_allocs.load();
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; ++i)
+    f();
+  double ns = std::chrono::duration<double, std::nano>(
+                  std::chrono::steady_clock::now() - start)
+                  .count();
+  std::printf("%-24s %10.0f ns/sample %8.1f allocs/sample\n", name,
+              ns / iterations,
+              static_cast<double>(g_allocs.load() - allocs) / iterations);
+}
+
+int main(int argc, char **argv) {
+  int iterations = argc > 1 ? std::atoi(argv[1]) : 20000;
+  if (iterations <= 0)
+    iterations = 20000;
+
+  std::map<std::string, before::DiskStats> prevDisk;
+  run("diskstats (before)", iterations, [&] {
+    auto curr = before::get_disk_stats();
+    long long total = 0;
+    for (auto const &[dev, s] : curr) {
+      if (prevDisk.count(dev))
+        total += s.sectors_read - prevDisk.at(dev).sectors_read;
+    }
+    prevDisk.swap(curr);
+    g_sink = total;
+  });
+
+  std::string diskBuffer;
+  LiveView::DeviceTable<LiveView::DiskStats> diskTable;
+  run("diskstats (after)", iterations, [&] {
+    LiveView::get_disk_stats(diskBuffer, diskTable);
+    long long total = 0;
+    for (size_t i = 0; i < diskTable.size(); ++i) {
+      const auto &e = diskTable[i];
+      if (e.present && e.hasPrevious)
+        total += e.value.sectors_read - e.previous.sectors_read;
+    }
+    g_sink = total;
+  });
+
+  std::map<std::string, before::NetworkStats> prevNet;
+  run("net/dev (before)", iterations, [&] {
+    auto curr = before::get_network_stats();
+    long long total = 0;
+    for (auto const &[iface, s] : curr) {
+      if (prevNet.count(iface))
+        total += s.bytes_received - prevNet.at(iface).bytes_received;
+    }
+    prevNet.swap(curr);
+    g_sink = total;
+  });
+
+  std::string netBuffer;
+  LiveView::DeviceTable<LiveView::NetworkStats> netTable;
+  run("net/dev (after)", iterations, [&] {
+    LiveView::get_network_stats(netBuffer, netTable);
+    long long total = 0;
+    for (size_t i = 0; i < netTable.size(); ++i)
+      total += LiveView::network_bytes_delta(netTable[i]);
+    g_sink = total;
+  });
+
+  LiveView::NetlinkLinkReader netlink;
+  LiveView::DeviceTable<LiveView::NetworkStats> linkTable;
+  if (netlink.is_open()) {
+    run("net (netlink)", iterations, [&] {
+      netlink.read(linkTable);
+      long long total = 0;
+      for (size_t i = 0; i < linkTable.size(); ++i)
+        total += LiveView::network_bytes_delta(linkTable[i]);
+      g_sink = total;
+    });
+  }
+  return 0;
+}
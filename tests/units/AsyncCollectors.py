@@ -0,0 +1,100 @@
+#!/usr/bin/env python3
+"""
+HardView.LiveView Unit Test
+Generated on: 2025-08-25 12:12:14
+Auto-generated test file for HardView.LiveView classes
+"""
+
+import sys
+import time
+import traceback
+
+def print_separator(title):
+    """Print a formatted separator"""
+    print("\n" + "="*60)
+    print(f" {title}")
+    print("="*60)
+
+def print_error(error_msg):
+    """Print formatted error message"""
+    print(f"[ERROR] Error: {error_msg}")
+
+def print_success(success_msg):
+    """Print formatted success message"""
+    print(f"[OK] {success_msg}")
+
+def print_info(info_msg):
+    """Print formatted info message"""
+    print(f"[INFO]  {info_msg}")
+
+def print_warning(warning_msg):
+    """Print formatted warning message"""
+    print(f"[W]  {warning_msg}")
+
+
+
+def test_async_collectors():
+    """Test the awaitable get_usage_async() collectors"""
+    print_separator("Testing get_usage_async (Linux only)")
+    
+    if not sys.platform.startswith("linux"):
+        print_warning("Async collectors are only supported on Linux, skipping")
+        return
+    
+    try:
+        import asyncio
+        from HardView.LiveView import PyLiveCPU, PyLiveDisk, PyLiveNetwork
+        print_success("Successfully imported LiveView collectors")
+        
+        async def run():
+            cpu = PyLiveCPU()
+            disk = PyLiveDisk(1)
+            net = PyLiveNetwork()
+            
+            print_info("Testing 200 concurrent CPU measurements...")
+            start = time.perf_counter()
+            usages = await asyncio.gather(*(cpu.get_usage_async(500) for _ in range(200)))
+            elapsed = time.perf_counter() - start
+            print(f"  {len(usages)} results in {elapsed * 1000:.0f} ms, "
+                  f"min {min(usages):.2f}%, max {max(usages):.2f}%")
+            
+            print_info("Testing disk and network...")
+            disk_usage, total, interfaces = await asyncio.gather(
+                disk.get_usage_async(500),
+                net.get_usage_async(500, 0),
+                net.get_usage_async(500, 1))
+            print(f"  Disk: {disk_usage}")
+            print(f"  Network: {total:.3f} MB/s, {len(interfaces)} interfaces")
+            
+            # The event loop keeps running while measurements are pending
+            ticks = 0
+            future = cpu.get_usage_async(300)
+            while not future.done():
+                ticks += 1
+                await asyncio.sleep(0.01)
+            print(f"  Loop ran {ticks} times during a 300 ms measurement: {future.result():.2f}%")
+            
+            # Cancelled futures are left alone when the result arrives
+            cancelled = cpu.get_usage_async(100)
+            cancelled.cancel()
+            await asyncio.sleep(0.2)
+            print(f"  Cancelled future: cancelled() = {cancelled.cancelled()}")
+        
+        asyncio.run(run())
+        
+        try:
+            PyLiveCPU().get_usage_async(100)
+            print_warning("get_usage_async() accepted a call without an event loop")
+        except RuntimeError as e:
+            print(f"  Without a running loop: {e}")
+        
+        print_success("Async collector tests completed successfully!")
+        
+    except ImportError as e:
+        print_error(f"Failed to import LiveView collectors: {e}")
+    except Exception as e:
+        print_error(f"Async collector test failed: {e}")
+        traceback.print_exc()
+
+if __name__ == "__main__":
+    test_async_collectors()
@@ -0,0 +1,82 @@
+#!/usr/bin/env python3
+"""
+HardView.LiveView Unit Test
+Generated on: 2025-08-25 12:12:14
+Auto-generated test file for HardView.LiveView classes
+"""
+
+import sys
+import time
+import traceback
+
+def print_separator(title):
+    """Print a formatted separator"""
+    print("\n" + "="*60)
+    print(f" {title}")
+    print("="*60)
+
+def print_error(error_msg):
+    """Print formatted error message"""
+    print(f"[ERROR] Error: {error_msg}")
+
+def print_success(success_msg):
+    """Print formatted success message"""
+    print(f"[OK] {success_msg}")
+
+def print_info(info_msg):
+    """Print formatted info message"""
+    print(f"[INFO]  {info_msg}")
+
+def print_warning(warning_msg):
+    """Print formatted warning message"""
+    print(f"[W]  {warning_msg}")
+
+
+
+def test_collector_stats():
+    """Test collector cost accounting"""
+    print_separator("Testing get_collector_stats")
+    
+    try:
+        from HardView.LiveView import PyLiveCPU, PyLiveRam, get_collector_stats, reset_collector_stats
+        print_success("Successfully imported get_collector_stats")
+        
+        # Take a few samples from a clean state
+        print_info("Testing counters after 10 CPU and RAM samples...")
+        reset_collector_stats()
+        cpu = PyLiveCPU()
+        ram = PyLiveRam()
+        for _ in range(10):
+            cpu.get_usage_delta()
+            ram.get_usage()
+        
+        stats = {s.name: s for s in get_collector_stats()}
+        print(f"  Collectors: {', '.join(stats)}")
+        for name in ("cpu", "ram"):
+            s = stats[name]
+            if s.calls < 10:
+                print_warning(f"{name}: expected at least 10 samples, got {s.calls}")
+            per_call = s.total_ns / s.calls / 1000 if s.calls else 0.0
+            print(f"  {name}: {s.calls} samples, {per_call:.1f} us/sample, "
+                  f"{s.syscalls} syscalls, {s.bytes_read} bytes, "
+                  f"io {s.io_ns} ns, parse {s.parse_ns} ns")
+            print(f"    p50 = {s.p50_ns} ns, p90 = {s.p90_ns} ns, p99 = {s.p99_ns} ns, max = {s.max_ns} ns")
+            if sum(count for _, count in s.histogram) != s.calls:
+                print_warning(f"{name}: histogram does not add up to the sample count")
+        
+        # Test reset
+        print_info("Testing reset_collector_stats...")
+        reset_collector_stats()
+        leftover = sum(s.calls for s in get_collector_stats())
+        print(f"  Samples after reset = {leftover}")
+        
+        print_success("Collector stats tests completed successfully!")
+        
+    except ImportError as e:
+        print_error(f"Failed to import get_collector_stats: {e}")
+    except Exception as e:
+        print_error(f"Collector stats test failed: {e}")
+        traceback.print_exc()
+
+if __name__ == "__main__":
+    test_collector_stats()
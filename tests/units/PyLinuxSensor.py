@@ -90,6 +90,19 @@ def test_pylinux_sensor():
             for i, (sensor_name, temp) in enumerate(valid_temps[:10]):
                 print(f"    {i+1}. {sensor_name}: {temp:.1f}°C")
         
+        # Test the single-pass bulk read
+        print_info("Testing bulk sensor read...")
+        all_readings = linux_sensor.get_all_sensors()
+        print(f"  Sensors read: {len(all_readings)}")
+        for label, value, chip, sensor_type in all_readings[:10]:
+            print(f"    [{chip}] {label} ({sensor_type}): {value:.2f}")
+        try:
+            import numpy
+            readings_array = linux_sensor.get_all_sensors_array()
+            print(f"  NumPy array: {readings_array.shape[0]} rows, dtype {readings_array.dtype}")
+        except ImportError:
+            print_warning("NumPy not installed - skipping get_all_sensors_array()")
+        
         # Test update functionality
         print_info("Testing sensor updates...")
         linux_sensor.update()
@@ -100,12 +113,21 @@ def test_pylinux_sensor():
         linux_sensor.update(names=True)
         print("  Sensor data and names updated")
         
+        # Test the direct hwmon backend against the default one
+        print_info(f"Testing hwmon backend (default backend: {linux_sensor.get_backend()})...")
+        from HardView.LiveView import SENSOR_BACKEND_HWMON
+        hwmon_sensor = PyLinuxSensor(backend=SENSOR_BACKEND_HWMON)
+        hwmon_names = hwmon_sensor.getAllSensorNames()
+        print(f"  Backend: {hwmon_sensor.get_backend()}, sensors found: {len(hwmon_names)}")
+        print(f"  CPU Temperature (hwmon): {hwmon_sensor.getCpuTemp():.1f}°C")
+        if linux_sensor.get_backend() == "libsensors" and hwmon_names != all_sensors:
+            print_warning("hwmon labels differ from libsensors labels (sensors.conf may relabel or ignore sensors)")
+        
         print_success("PyLinuxSensor tests completed successfully!")
         
     except ImportError as e:
         print_error(f"Failed to import PyLinuxSensor: {e}")
-        print_info("Note: PyLinuxSensor requires lm-sensors library to be installed")
-        print_info("Install with: sudo apt-get install lm-sensors libsensors4-dev")
+        print_info("Note: without lm-sensors, PyLinuxSensor reads /sys/class/hwmon directly")
     except Exception as e:
         print_error(f"PyLinuxSensor test failed: {e}")
         print_info("Note: Linux sensor monitoring requires lm-sensors and proper hardware support")
@@ -51,6 +51,14 @@ def test_pylive_cpu():
             print(f"  Cycle {i+1}: CPU Usage = {usage:.2f}%")
             time.sleep(0.5)
         
+        # Test non-blocking delta mode
+        print_info("Testing non-blocking CPU usage (delta mode)...")
+        cpu_monitor.get_usage_delta()
+        for i in range(3):
+            time.sleep(0.5)
+            usage, elapsed_ms = cpu_monitor.get_usage_delta()
+            print(f"  Cycle {i+1}: CPU Usage = {usage:.2f}% over {elapsed_ms:.0f} ms")
+        
         # Test CPUID information
         print_info("Testing CPUID information...")
         cpu_info = cpu_monitor.cpuid()
@@ -79,6 +87,16 @@ def test_pylive_cpu():
                 print_warning(f"Windows-specific CPU features failed: {e}")
         else:
             print_info("Windows-specific features skipped (not on Windows)")
+        
+        # Linux-specific tests
+        if sys.platform.startswith("linux"):
+            print_info("Testing per-core CPU usage...")
+            cpu_monitor.get_per_core_usage()
+            time.sleep(0.5)
+            per_core = cpu_monitor.get_per_core_usage()
+            for core in range(min(len(per_core) // 6, 4)):
+                user, system, iowait = per_core[core * 6:core * 6 + 3]
+                print(f"  cpu{core}: user = {user:.1f}%, system = {system:.1f}%, iowait = {iowait:.1f}%")
             
         print_success("PyLiveCPU tests completed successfully!")
         
@@ -0,0 +1,83 @@
+#!/usr/bin/env python3
+"""
+HardView.LiveView Unit Test
+Generated on: 2025-08-25 12:12:14
+Auto-generated test file for HardView.LiveView classes
+"""
+
+import sys
+import time
+import traceback
+
+def print_separator(title):
+    """Print a formatted separator"""
+    print("\n" + "="*60)
+    print(f" {title}")
+    print("="*60)
+
+def print_error(error_msg):
+    """Print formatted error message"""
+    print(f"[ERROR] Error: {error_msg}")
+
+def print_success(success_msg):
+    """Print formatted success message"""
+    print(f"[OK] {success_msg}")
+
+def print_info(info_msg):
+    """Print formatted info message"""
+    print(f"[INFO]  {info_msg}")
+
+def print_warning(warning_msg):
+    """Print formatted warning message"""
+    print(f"[W]  {warning_msg}")
+
+
+
+def test_live_cpu_freq():
+    """Test PyLiveCPUFreq per-core frequencies"""
+    print_separator("Testing PyLiveCPUFreq (Linux only)")
+    
+    if not sys.platform.startswith("linux"):
+        print_warning("PyLiveCPUFreq is only supported on Linux, skipping")
+        return
+    
+    try:
+        from HardView.LiveView import PyLiveCPUFreq
+        print_success("Successfully imported PyLiveCPUFreq")
+        
+        freq = PyLiveCPUFreq()
+        print(f"  CPUID 0x16: base {freq.get_base_frequency():.0f} MHz, "
+              f"max {freq.get_max_frequency():.0f} MHz, bus {freq.get_bus_frequency():.0f} MHz")
+        
+        print_info("Testing get_frequencies(500)...")
+        cores = freq.get_frequencies(500)
+        print(f"  {len(cores)} online cores, APERF/MPERF available: {freq.has_effective_frequency()}")
+        for core in cores[:8]:
+            print(f"  cpu{core.cpu}: cur {core.cur_MHz:.0f} MHz, limits {core.min_MHz:.0f}-{core.max_MHz:.0f} MHz, "
+                  f"effective {core.effective_MHz:.0f} MHz")
+        if not cores:
+            print_warning("No online cores found")
+        
+        print_info("Testing get_frequencies_delta()...")
+        first, elapsed_ms = freq.get_frequencies_delta()
+        print(f"  First call: elapsed {elapsed_ms:.0f} ms")
+        time.sleep(0.2)
+        cores, elapsed_ms = freq.get_frequencies_delta()
+        print(f"  Second call: elapsed {elapsed_ms:.0f} ms, cpu0 effective {cores[0].effective_MHz:.0f} MHz")
+        
+        start = time.perf_counter()
+        for _ in range(100):
+            freq.get_frequencies_delta()
+        elapsed = time.perf_counter() - start
+        print(f"  100 sweeps in {elapsed * 1000:.1f} ms")
+        
+        print_success("PyLiveCPUFreq tests completed successfully!")
+        
+    except ImportError as e:
+        print_error(f"Failed to import PyLiveCPUFreq: {e}")
+    except Exception as e:
+        print_error(f"PyLiveCPUFreq test failed: {e}")
+        traceback.print_exc()
+
+if __name__ == "__main__":
+    test_live_cpu_freq()
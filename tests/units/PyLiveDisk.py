@@ -69,6 +69,27 @@ def test_pylive_disk():
             print(f"  Cycle {i+1}: Read = {read_speed:.2f} MB/s, Write = {write_speed:.2f} MB/s")
             time.sleep(0.5)
         
+        # Test non-blocking delta mode
+        print_info("Testing non-blocking R/W speed (delta mode)...")
+        disk_monitor_speed.get_usage_delta()
+        for i in range(3):
+            time.sleep(0.5)
+            rw_speed, elapsed_ms = disk_monitor_speed.get_usage_delta()
+            print(f"  Cycle {i+1}: Read = {rw_speed[0][1]:.2f} MB/s, Write = {rw_speed[1][1]:.2f} MB/s over {elapsed_ms:.0f} ms")
+        
+        # Test per-device metrics (Linux only)
+        if hasattr(disk_monitor_speed, "get_device_stats"):
+            print_info("Testing per-device disk metrics...")
+            devices = disk_monitor_speed.get_device_stats(interval=1000)
+            for dev in devices:
+                print(f"  {dev.name}: R {dev.read_iops:.0f} / W {dev.write_iops:.0f} IOPS, "
+                      f"await R {dev.read_await_ms:.2f} / W {dev.write_await_ms:.2f} ms, "
+                      f"queue {dev.avg_queue_size:.2f}, in flight {dev.in_flight}, busy {dev.busy_percent:.1f}%")
+            disk_monitor_speed.get_device_stats_delta()
+            time.sleep(0.5)
+            devices, elapsed_ms = disk_monitor_speed.get_device_stats_delta()
+            print(f"  Delta: {len(devices)} devices over {elapsed_ms:.0f} ms")
+        
         # Test high disk usage detection
         print_info("Testing high disk usage detection...")
         is_high_50 = disk_monitor_speed.HighDiskUsage(threshold_mbps=50.0)
@@ -58,6 +58,30 @@ def test_pylive_network():
         for interface, speed in interface_traffic:
             print(f"    {interface}: {speed:.4f} MB/s")
         
+        # Test non-blocking delta mode
+        print_info("Testing non-blocking network usage (delta mode)...")
+        net_monitor.get_usage_delta(mode=0)
+        for i in range(3):
+            time.sleep(0.5)
+            total_traffic, elapsed_ms = net_monitor.get_usage_delta(mode=0)
+            print(f"  Cycle {i+1}: Total Network Usage = {total_traffic:.4f} MB/s over {elapsed_ms:.0f} ms")
+        
+        # Test per-interface statistics (Linux only)
+        if hasattr(net_monitor, "get_interface_stats"):
+            print_info(f"Testing per-interface statistics (backend: {net_monitor.get_backend()})...")
+            for iface in net_monitor.get_interface_stats(interval=1000):
+                print(f"    {iface.name}: rx {iface.rx_MBps:.4f} MB/s ({iface.rx_packets:.0f} pkt/s), "
+                      f"tx {iface.tx_MBps:.4f} MB/s ({iface.tx_packets:.0f} pkt/s), "
+                      f"errors {iface.rx_errors + iface.tx_errors:.0f}/s, drops {iface.rx_drops + iface.tx_drops:.0f}/s")
+            net_monitor.get_interface_stats_delta()
+            time.sleep(0.5)
+            interfaces, elapsed_ms = net_monitor.get_interface_stats_delta()
+            print(f"  Delta: {len(interfaces)} interfaces over {elapsed_ms:.0f} ms")
+
+            from HardView.LiveView import NET_BACKEND_PROCFS
+            procfs_monitor = PyLiveNetwork(backend=NET_BACKEND_PROCFS)
+            print(f"  Forced backend: {procfs_monitor.get_backend()}")
+
         # Test highest usage interface
         print_info("Testing highest usage interface detection...")
         busiest_card = net_monitor.getHighCard()
@@ -0,0 +1,102 @@
+#!/usr/bin/env python3
+"""
+HardView.LiveView Unit Test
+Generated on: 2025-08-25 12:12:14
+Auto-generated test file for HardView.LiveView classes
+"""
+
+import sys
+import time
+import traceback
+
+def print_separator(title):
+    """Print a formatted separator"""
+    print("\n" + "="*60)
+    print(f" {title}")
+    print("="*60)
+
+def print_error(error_msg):
+    """Print formatted error message"""
+    print(f"[ERROR] Error: {error_msg}")
+
+def print_success(success_msg):
+    """Print formatted success message"""
+    print(f"[OK] {success_msg}")
+
+def print_info(info_msg):
+    """Print formatted info message"""
+    print(f"[INFO]  {info_msg}")
+
+def print_warning(warning_msg):
+    """Print formatted warning message"""
+    print(f"[W]  {warning_msg}")
+
+
+
+def test_live_pressure():
+    """Test PyLivePressure readings and PSI triggers"""
+    print_separator("Testing PyLivePressure (Linux only)")
+    
+    if not sys.platform.startswith("linux"):
+        print_warning("PSI is only supported on Linux, skipping")
+        return
+    
+    try:
+        import threading
+        from HardView.LiveView import PyLivePressure
+        print_success("Successfully imported PyLivePressure")
+        
+        psi = PyLivePressure()
+        print_info("Testing get_all()...")
+        try:
+            for stats in psi.get_all():
+                print(f"  {stats.resource}: some avg10={stats.some.avg10:.2f} avg60={stats.some.avg60:.2f} "
+                      f"avg300={stats.some.avg300:.2f} total={stats.some.total_us} us"
+                      + (f", full avg10={stats.full.avg10:.2f}" if stats.has_full else ""))
+        except RuntimeError as e:
+            print_warning(f"PSI not available: {e}")
+            return
+        
+        try:
+            psi.get_pressure("gpu")
+            print_warning("Unknown resource accepted")
+        except ValueError as e:
+            print(f"  Unknown resource rejected: {e}")
+        
+        print_info("Testing PSI triggers...")
+        try:
+            trigger = psi.add_trigger("cpu", 1000, 2000000)
+        except RuntimeError as e:
+            print_warning(f"Trigger refused (needs write access to /proc/pressure/cpu): {e}")
+            return
+        print(f"  Trigger {trigger} registered, {psi.trigger_count()} active")
+        
+        # Stall the CPU with more busy processes than cores
+        import os
+        import subprocess
+        burn = "import time\nstop = time.time() + 2\nwhile time.time() < stop: pass"
+        workers = [subprocess.Popen([sys.executable, "-c", burn]) for _ in range(2 * (os.cpu_count() or 1))]
+        fired = psi.wait(3000)
+        for w in workers:
+            w.wait()
+        print(f"  wait() under load returned {fired}")
+        
+        # interrupt() wakes a waiting thread
+        timer = threading.Timer(0.2, psi.interrupt)
+        timer.start()
+        start = time.perf_counter()
+        fired = psi.wait(5000)
+        print(f"  Interrupted after {(time.perf_counter() - start) * 1000:.0f} ms, returned {fired}")
+        
+        print(f"  remove_trigger({trigger}) = {psi.remove_trigger(trigger)}, {psi.trigger_count()} active")
+        
+        print_success("PyLivePressure tests completed successfully!")
+        
+    except ImportError as e:
+        print_error(f"Failed to import PyLivePressure: {e}")
+    except Exception as e:
+        print_error(f"PyLivePressure test failed: {e}")
+        traceback.print_exc()
+
+if __name__ == "__main__":
+    test_live_pressure()
@@ -0,0 +1,127 @@
+#!/usr/bin/env python3
+"""
+HardView.LiveView Unit Test
+Generated on: 2025-08-25 12:12:14
+Auto-generated test file for HardView.LiveView classes
+"""
+
+import sys
+import time
+import traceback
+
+def print_separator(title):
+    """Print a formatted separator"""
+    print("\n" + "="*60)
+    print(f" {title}")
+    print("="*60)
+
+def print_error(error_msg):
+    """Print formatted error message"""
+    print(f"[ERROR] Error: {error_msg}")
+
+def print_success(success_msg):
+    """Print formatted success message"""
+    print(f"[OK] {success_msg}")
+
+def print_info(info_msg):
+    """Print formatted info message"""
+    print(f"[INFO]  {info_msg}")
+
+def print_warning(warning_msg):
+    """Print formatted warning message"""
+    print(f"[W]  {warning_msg}")
+
+
+
+def test_live_replay():
+    """Test sampler recording and replay"""
+    print_separator("Testing PyLiveReplay (Linux only)")
+    
+    if not sys.platform.startswith("linux"):
+        print_warning("PyLiveReplay is only supported on Linux, skipping")
+        return
+    
+    try:
+        import os
+        import tempfile
+        from HardView.LiveView import PySamplerService, PyLiveReplay
+        print_success("Successfully imported PyLiveReplay")
+        
+        path = os.path.join(tempfile.mkdtemp(), "test.hvrec")
+        
+        # Record one second at 50 ms
+        print_info("Recording 1 second at 50 ms...")
+        sampler = PySamplerService(interval_ms=50, capacity=100)
+        sampler.start_recording(path, sensors=True)
+        print(f"  is_recording() = {sampler.is_recording()}")
+        sampler.start()
+        time.sleep(1)
+        sampler.stop()
+        sampler.stop_recording()
+        live = sampler.history()
+        print(f"  Live samples = {len(live)}, file size = {os.path.getsize(path)} bytes")
+        
+        # Replay as fast as possible; the samples must match the live ones
+        print_info("Testing read()...")
+        replay = PyLiveReplay(path)
+        start = time.perf_counter()
+        samples = replay.read()
+        elapsed = time.perf_counter() - start
+        print(f"  Replayed {len(samples)} samples in {elapsed * 1000:.2f} ms ({replay.frame_count()} frames)")
+        if len(samples) != len(live):
+            print_warning(f"Expected {len(live)} samples")
+        for l, r in zip(live, samples):
+            if abs(l.cpu_usage - r.cpu_usage) > 1e-6 or abs(l.ram_usage - r.ram_usage) > 1e-6:
+                print_warning("Replayed sample differs from the live sample")
+                break
+        if samples:
+            s = samples[-1]
+            print(f"  Last: CPU {s.cpu_usage:.1f}%, RAM {s.ram_usage:.1f}%, "
+                  f"Disk R {s.disk_read_MBps:.2f} MB/s, Net {s.net_MBps:.3f} MB/s")
+        print(f"  Sensors in the last frame = {len(replay.get_sensors())}")
+        
+        # Replay at 1000x real time
+        print_info("Testing play() at 1000x...")
+        replay.rewind()
+        received = []
+        start = time.perf_counter()
+        count = replay.play(received.append, speed=1000)
+        elapsed = time.perf_counter() - start
+        print(f"  Played {count} samples in {elapsed * 1000:.2f} ms")
+        
+        # Cut the last frame as a crash would, then record more into the file
+        print_info("Testing an append after a torn frame...")
+        frames = replay.frame_count()
+        with open(path, "r+b") as f:
+            f.truncate(os.path.getsize(path) - 10)
+        sampler.start_recording(path)
+        sampler.start()
+        time.sleep(0.5)
+        sampler.stop()
+        sampler.stop_recording()
+        appended = PyLiveReplay(path)
+        appended.read()
+        print(f"  Frames before = {frames}, after the append = {appended.frame_count()}")
+        if appended.frame_count() < frames:
+            print_warning("Frames were lost by the append")
+        
+        # Not a recording
+        print_info("Testing an invalid file...")
+        with open(path + ".bad", "wb") as f:
+            f.write(b"not a recording")
+        try:
+            PyLiveReplay(path + ".bad")
+            print_warning("PyLiveReplay accepted an invalid file")
+        except RuntimeError as e:
+            print(f"  Rejected: {e}")
+        
+        print_success("Replay tests completed successfully!")
+        
+    except ImportError as e:
+        print_error(f"Failed to import PyLiveReplay: {e}")
+    except Exception as e:
+        print_error(f"Replay test failed: {e}")
+        traceback.print_exc()
+
+if __name__ == "__main__":
+    test_live_replay()
@@ -0,0 +1,69 @@
+#!/usr/bin/env python3
+"""
+HardView.LiveView Unit Test
+Generated on: 2025-08-25 12:12:14
+Auto-generated test file for HardView.LiveView classes
+"""
+
+import sys
+import time
+import traceback
+
+def print_separator(title):
+    """Print a formatted separator"""
+    print("\n" + "="*60)
+    print(f" {title}")
+    print("="*60)
+
+def print_error(error_msg):
+    """Print formatted error message"""
+    print(f"[ERROR] Error: {error_msg}")
+
+def print_success(success_msg):
+    """Print formatted success message"""
+    print(f"[OK] {success_msg}")
+
+def print_info(info_msg):
+    """Print formatted info message"""
+    print(f"[INFO]  {info_msg}")
+
+def print_warning(warning_msg):
+    """Print formatted warning message"""
+    print(f"[W]  {warning_msg}")
+
+
+
+def test_pylive_snapshot():
+    """Test PyLiveSnapshot class functionality"""
+    print_separator("Testing PyLiveSnapshot")
+    
+    try:
+        from HardView.LiveView import PyLiveSnapshot, SNAPSHOT_CPU, SNAPSHOT_NETWORK
+        print_success("Successfully imported PyLiveSnapshot")
+        
+        # Test all subsystems over one interval
+        print_info("Testing snapshot of all subsystems...")
+        snapshot = PyLiveSnapshot()
+        start = time.time()
+        result = snapshot.take(interval_ms=1000)
+        print(f"  Call took {time.time() - start:.2f} s (interval {result.interval_ms:.0f} ms)")
+        print(f"  CPU = {result.cpu_usage:.2f}%, RAM = {result.ram_usage:.2f}%")
+        print(f"  Disk Read = {result.disk_read_MBps:.2f} MB/s, Write = {result.disk_write_MBps:.2f} MB/s")
+        print(f"  Network = {result.net_MBps:.4f} MB/s on {len(result.net_interfaces)} interfaces")
+        
+        # Test subsystem selection
+        print_info("Testing snapshot of CPU and network only...")
+        partial = PyLiveSnapshot(SNAPSHOT_CPU | SNAPSHOT_NETWORK).take(interval_ms=500)
+        print(f"  CPU = {partial.cpu_usage:.2f}%, Network = {partial.net_MBps:.4f} MB/s")
+        print(f"  Unselected RAM field = {partial.ram_usage}")
+        
+        print_success("PyLiveSnapshot tests completed successfully!")
+        
+    except ImportError as e:
+        print_error(f"Failed to import PyLiveSnapshot: {e}")
+    except Exception as e:
+        print_error(f"PyLiveSnapshot test failed: {e}")
+        traceback.print_exc()
+
+if __name__ == "__main__":
+    test_pylive_snapshot()
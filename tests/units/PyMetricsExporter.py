@@ -0,0 +1,120 @@
+#!/usr/bin/env python3
+"""
+HardView.LiveView Unit Test
+Generated on: 2025-08-25 12:12:14
+Auto-generated test file for HardView.LiveView classes
+"""
+
+import sys
+import time
+import traceback
+
+def print_separator(title):
+    """Print a formatted separator"""
+    print("\n" + "="*60)
+    print(f" {title}")
+    print("="*60)
+
+def print_error(error_msg):
+    """Print formatted error message"""
+    print(f"[ERROR] Error: {error_msg}")
+
+def print_success(success_msg):
+    """Print formatted success message"""
+    print(f"[OK] {success_msg}")
+
+def print_info(info_msg):
+    """Print formatted info message"""
+    print(f"[INFO]  {info_msg}")
+
+def print_warning(warning_msg):
+    """Print formatted warning message"""
+    print(f"[W]  {warning_msg}")
+
+
+
+def fetch(url, accept=None):
+    """GET a URL and return (status, content type, body)"""
+    import urllib.request
+    import urllib.error
+    request = urllib.request.Request(url)
+    if accept:
+        request.add_header("Accept", accept)
+    try:
+        with urllib.request.urlopen(request, timeout=5) as response:
+            return response.status, response.headers.get("Content-Type"), response.read().decode()
+    except urllib.error.HTTPError as e:
+        return e.code, e.headers.get("Content-Type"), e.read().decode()
+
+def test_metrics_exporter():
+    """Test the Prometheus /metrics endpoint"""
+    print_separator("Testing PyMetricsExporter (Linux only)")
+    
+    if not sys.platform.startswith("linux"):
+        print_warning("PyMetricsExporter is only supported on Linux, skipping")
+        return
+    
+    try:
+        from HardView.LiveView import PySamplerService, PyMetricsExporter
+        print_success("Successfully imported PyMetricsExporter")
+        
+        sampler = PySamplerService(interval_ms=100)
+        exporter = PyMetricsExporter(sampler, "127.0.0.1", 0, labels={"host": "test"})
+        exporter.start()
+        url = f"http://127.0.0.1:{exporter.get_port()}/metrics"
+        print(f"  Serving {url}")
+        
+        # Before the first sample only the counters are served
+        status, content_type, body = fetch(url)
+        print(f"  Before start(): {status}, {len(body.splitlines())} lines")
+        
+        sampler.start()
+        time.sleep(0.5)
+        
+        print_info("Testing the Prometheus text format...")
+        status, content_type, body = fetch(url)
+        print(f"  Status {status}, Content-Type: {content_type}")
+        for line in body.splitlines():
+            if not line.startswith("#"):
+                print(f"    {line}")
+        for name in ("hardview_cpu_usage_percent", "hardview_sampler_samples_total",
+                     "hardview_disk_throughput_bytes_per_second"):
+            if name not in body:
+                print_warning(f"{name} missing from the scrape")
+        
+        print_info("Testing OpenMetrics...")
+        status, content_type, body = fetch(url, "application/openmetrics-text; version=1.0.0")
+        print(f"  Status {status}, Content-Type: {content_type}")
+        if not body.endswith("# EOF\n"):
+            print_warning("OpenMetrics body does not end with # EOF")
+        
+        print_info("Testing scrape cost...")
+        start = time.perf_counter()
+        for _ in range(100):
+            fetch(url)
+        elapsed = time.perf_counter() - start
+        print(f"  100 scrapes in {elapsed * 1000:.1f} ms ({exporter.scrape_count()} answered)")
+        
+        status, _, _ = fetch(f"http://127.0.0.1:{exporter.get_port()}/other")
+        print(f"  /other -> {status}")
+        
+        exporter.stop()
+        sampler.stop()
+        print(f"  After stop(): is_running = {exporter.is_running()}, port = {exporter.get_port()}")
+        
+        try:
+            PyMetricsExporter(sampler, labels={"bad-name": "x"})
+            print_warning("Invalid label name accepted")
+        except ValueError as e:
+            print(f"  Rejected: {e}")
+        
+        print_success("Exporter tests completed successfully!")
+        
+    except ImportError as e:
+        print_error(f"Failed to import PyMetricsExporter: {e}")
+    except Exception as e:
+        print_error(f"Exporter test failed: {e}")
+        traceback.print_exc()
+
+if __name__ == "__main__":
+    test_metrics_exporter()
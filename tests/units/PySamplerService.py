@@ -0,0 +1,104 @@
+#!/usr/bin/env python3
+"""
+HardView.LiveView Unit Test
+Generated on: 2025-08-25 12:12:14
+Auto-generated test file for HardView.LiveView classes
+"""
+
+import sys
+import time
+import traceback
+
+def print_separator(title):
+    """Print a formatted separator"""
+    print("\n" + "="*60)
+    print(f" {title}")
+    print("="*60)
+
+def print_error(error_msg):
+    """Print formatted error message"""
+    print(f"[ERROR] Error: {error_msg}")
+
+def print_success(success_msg):
+    """Print formatted success message"""
+    print(f"[OK] {success_msg}")
+
+def print_info(info_msg):
+    """Print formatted info message"""
+    print(f"[INFO]  {info_msg}")
+
+def print_warning(warning_msg):
+    """Print formatted warning message"""
+    print(f"[W]  {warning_msg}")
+
+
+
+def test_pysampler_service():
+    """Test PySamplerService class functionality"""
+    print_separator("Testing PySamplerService")
+    
+    try:
+        from HardView.LiveView import PySamplerService
+        print_success("Successfully imported PySamplerService")
+        
+        # Initialize sampler service
+        sampler = PySamplerService(interval_ms=200, capacity=16)
+        print_success("Successfully created PySamplerService instance")
+        
+        # Test background sampling
+        print_info("Testing background sampling...")
+        sampler.start()
+        print(f"  Running: {sampler.is_running()}")
+        time.sleep(1.5)
+        
+        sample = sampler.latest()
+        if sample is None:
+            print_warning("No sample collected yet")
+        else:
+            print(f"  CPU = {sample.cpu_usage:.2f}%, RAM = {sample.ram_usage:.2f}%")
+            print(f"  Disk Read = {sample.disk_read_MBps:.2f} MB/s, Write = {sample.disk_write_MBps:.2f} MB/s")
+            print(f"  Network = {sample.net_MBps:.4f} MB/s over {sample.interval_ms:.0f} ms")
+        
+        # Test sample history
+        print_info("Testing sample history...")
+        history = sampler.history()
+        print(f"  History: {len(history)} samples (capacity {sampler.capacity()}, total {sampler.sample_count()})")
+        if len(history) > 1:
+            ordered = all(a.timestamp_ns < b.timestamp_ns for a, b in zip(history, history[1:]))
+            print(f"  Timestamps ordered: {ordered}")
+        print(f"  Collection errors: {sampler.get_error_count()}")
+        
+        # Test NumPy history
+        print_info("Testing NumPy history...")
+        try:
+            import numpy
+            records = sampler.history_array()
+            print(f"  history_array(): shape {records.shape}, fields {records.dtype.names}")
+            columns = sampler.history_columns()
+            cpu = columns["cpu_usage"]
+            print(f"  history_columns(): {len(columns)} columns, cpu_usage {cpu.dtype} x {len(cpu)}")
+            print(f"  Columns share one buffer: {numpy.shares_memory(columns['cpu_usage'], columns['ram_usage'])}")
+            if sys.platform.startswith("linux"):
+                layout = sampler.history_layout()
+                print(f"  history_layout(): {len(layout['cores'])} cores, disks {layout['disks']}, interfaces {layout['interfaces']}")
+                print(f"  core_usage: shape {columns['core_usage'].shape}")
+            start = time.perf_counter()
+            for _ in range(1000):
+                sampler.history_columns()
+            print(f"  history_columns() = {(time.perf_counter() - start) * 1000:.1f} us per call")
+        except ImportError:
+            print_warning("NumPy is not installed, skipping")
+        
+        sampler.stop()
+        print(f"  Running after stop: {sampler.is_running()}")
+        
+        print_success("PySamplerService tests completed successfully!")
+        
+    except ImportError as e:
+        print_error(f"Failed to import PySamplerService: {e}")
+    except Exception as e:
+        print_error(f"PySamplerService test failed: {e}")
+        traceback.print_exc()
+
+if __name__ == "__main__":
+    test_pysampler_service()
@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+"""
+HardView.LiveView Unit Test
+Generated on: 2025-08-25 12:12:14
+Auto-generated test file for HardView.LiveView classes
+"""
+
+import sys
+import time
+import traceback
+
+def print_separator(title):
+    """Print a formatted separator"""
+    print("\n" + "="*60)
+    print(f" {title}")
+    print("="*60)
+
+def print_error(error_msg):
+    """Print formatted error message"""
+    print(f"[ERROR] Error: {error_msg}")
+
+def print_success(success_msg):
+    """Print formatted success message"""
+    print(f"[OK] {success_msg}")
+
+def print_info(info_msg):
+    """Print formatted info message"""
+    print(f"[INFO]  {info_msg}")
+
+def print_warning(warning_msg):
+    """Print formatted warning message"""
+    print(f"[W]  {warning_msg}")
+
+
+
+def test_shared_metrics():
+    """Test publishing samples to shared memory and reading them back"""
+    print_separator("Testing PySharedMetricsReader (Linux only)")
+    
+    if not sys.platform.startswith("linux"):
+        print_warning("Shared-memory publishing is only supported on Linux, skipping")
+        return
+    
+    try:
+        import os
+        import subprocess
+        from HardView.LiveView import PySamplerService, PySharedMetricsReader
+        print_success("Successfully imported PySharedMetricsReader")
+        
+        name = f"/hardview_test_{os.getpid()}"
+        sampler = PySamplerService(interval_ms=50)
+        sampler.start_publishing(name)
+        print(f"  Publishing to /dev/shm{name}, is_publishing() = {sampler.is_publishing()}")
+        
+        # A second publisher under the same name is refused
+        other = PySamplerService()
+        try:
+            other.start_publishing(name)
+            print_warning("Second publisher accepted")
+        except RuntimeError as e:
+            print(f"  Second publisher rejected: {e}")
+        
+        reader = PySharedMetricsReader(name)
+        print(f"  Before start(): read() = {reader.read()}, publisher_pid = {reader.publisher_pid()}")
+        
+        sampler.start()
+        time.sleep(0.5)
+        
+        print_info("Testing read()...")
+        sample = reader.read()
+        if sample:
+            print(f"  #{reader.sample_count()}: CPU {sample.cpu_usage:.1f}%, RAM {sample.ram_usage:.1f}%, "
+                  f"Disk R {sample.disk_read_MBps:.2f} MB/s, Net {sample.net_MBps:.3f} MB/s")
+        else:
+            print_warning("Nothing published after 0.5 s")
+        
+        start = time.perf_counter()
+        for _ in range(100000):
+            reader.read()
+        elapsed = time.perf_counter() - start
+        print(f"  100000 reads in {elapsed * 1000:.1f} ms")
+        
+        # Another process reads the same segment
+        print_info("Testing a reader in another process...")
+        code = ("from HardView.LiveView import PySharedMetricsReader; "
+                f"r = PySharedMetricsReader('{name}'); s = r.read(); "
+                "print(f'  child: #{r.sample_count()} CPU {s.cpu_usage:.1f}%')")
+        subprocess.run([sys.executable, "-c", code], check=False)
+        
+        sampler.stop()
+        sampler.stop_publishing()
+        print(f"  After stop_publishing(): publisher_pid = {reader.publisher_pid()}, "
+              f"alive = {reader.publisher_alive()}")
+        try:
+            PySharedMetricsReader(name)
+            print_warning("Segment still exists after stop_publishing()")
+        except RuntimeError as e:
+            print(f"  Segment removed: {e}")
+        
+        print_success("Shared metrics tests completed successfully!")
+        
+    except ImportError as e:
+        print_error(f"Failed to import PySharedMetricsReader: {e}")
+    except Exception as e:
+        print_error(f"Shared metrics test failed: {e}")
+        traceback.print_exc()
+
+if __name__ == "__main__":
+    test_shared_metrics()
@@ -0,0 +1,86 @@
+#!/usr/bin/env python3
+"""
+HardView.LiveView Unit Test
+Generated on: 2025-08-25 12:12:14
+Auto-generated test file for HardView.LiveView classes
+"""
+
+import sys
+import time
+import traceback
+
+def print_separator(title):
+    """Print a formatted separator"""
+    print("\n" + "="*60)
+    print(f" {title}")
+    print("="*60)
+
+def print_error(error_msg):
+    """Print formatted error message"""
+    print(f"[ERROR] Error: {error_msg}")
+
+def print_success(success_msg):
+    """Print formatted success message"""
+    print(f"[OK] {success_msg}")
+
+def print_info(info_msg):
+    """Print formatted info message"""
+    print(f"[INFO]  {info_msg}")
+
+def print_warning(warning_msg):
+    """Print formatted warning message"""
+    print(f"[W]  {warning_msg}")
+
+
+
+def test_sys_root():
+    """Test reading a captured /proc and /sys tree"""
+    print_separator("Testing set_sys_root (Linux only)")
+    
+    if not sys.platform.startswith("linux"):
+        print_warning("set_sys_root is only supported on Linux, skipping")
+        return
+    
+    try:
+        import os
+        from HardView.LiveView import PyLiveRam, PyLinuxSensor, set_sys_root, get_sys_root
+        print_success("Successfully imported set_sys_root")
+        
+        # The benchmark fixtures are a capture of an 8-thread desktop
+        fixtures = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "bench", "fixtures")
+        print_info("Testing the default sysroot...")
+        print(f"  Sysroot = '{get_sys_root()}'")
+        
+        print_info(f"Testing set_sys_root('{fixtures}')...")
+        set_sys_root(fixtures + "/")
+        print(f"  Sysroot = '{get_sys_root()}'")
+        ram = PyLiveRam()
+        print(f"  RAM usage from the capture = {ram.get_usage():.1f}%")
+        sensor = PyLinuxSensor()
+        names = sensor.get_all_sensor_names()
+        print(f"  Sensor backend = {sensor.get_backend()}, {len(names)} sensors")
+        if sensor.get_backend() != "hwmon":
+            print_warning("Expected the hwmon backend while a sysroot is set")
+        
+        # Invalid roots are rejected
+        print_info("Testing an invalid sysroot...")
+        try:
+            set_sys_root(os.path.join(fixtures, "missing"))
+            print_warning("set_sys_root accepted a missing directory")
+        except ValueError as e:
+            print(f"  Rejected: {e}")
+        
+        # Back to the live system
+        set_sys_root("")
+        print(f"  Live RAM usage = {PyLiveRam().get_usage():.1f}%")
+        
+        print_success("Sysroot tests completed successfully!")
+        
+    except ImportError as e:
+        print_error(f"Failed to import set_sys_root: {e}")
+    except Exception as e:
+        print_error(f"Sysroot test failed: {e}")
+        traceback.print_exc()
+
+if __name__ == "__main__":
+    test_sys_root()